@@ -12,6 +12,7 @@ OPTION(WITH_MAGICK "With GraphicsMagick++." OFF)
 OPTION(WITH_ITK "With Insight Toolkit ITK." OFF)
 OPTION(WITH_CAIRO "With CairoGraphics." OFF)
 OPTION(WITH_COIN3D-SOQT "With COIN3D & SOQT for 3D visualization (Qt required)." OFF)
+OPTION(WITH_OPENMP "With OpenMP (multithreaded algorithms)." OFF)
 OPTION(WITH_ALL "With all optional dependencies." OFF)
 
 
@@ -23,6 +24,7 @@ IF(WITH_ALL)
   SET( WITH_COIN3D-SOQT  TRUE)
   SET( WITH_QGLVIEWER  TRUE)
   SET( WITH_MAGICK  TRUE)
+  SET( WITH_OPENMP  TRUE)
 ENDIF(WITH_ALL)
 
 
@@ -45,6 +47,24 @@ IF(WITH_GMP)
   ENDIF(GMP_FOUND)
 ENDIF(WITH_GMP)
 
+# -----------------------------------------------------------------------------
+# Look for OpenMP
+# (They are not compulsory).
+# -----------------------------------------------------------------------------
+IF(WITH_OPENMP)
+  FIND_PACKAGE(OpenMP REQUIRED)
+  IF(OPENMP_FOUND)
+    SET(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} ${OpenMP_C_FLAGS}")
+    SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${OpenMP_CXX_FLAGS}")
+    SET(CMAKE_EXE_LINKER_FLAGS "${CMAKE_EXE_LINKER_FLAGS} ${OpenMP_CXX_FLAGS}")
+    SET(CMAKE_SHARED_LINKER_FLAGS "${CMAKE_SHARED_LINKER_FLAGS} ${OpenMP_CXX_FLAGS}")
+    message(STATUS "(optional) OpenMP found." )
+    ADD_DEFINITIONS("-DWITH_OPENMP ")
+  ELSE(OPENMP_FOUND)
+    message(STATUS "(optional) OpenMP not found." )
+  ENDIF(OPENMP_FOUND)
+ENDIF(WITH_OPENMP)
+
 # -----------------------------------------------------------------------------
 # Look for GraphicsMagic
 # (They are not compulsory).
@@ -248,3 +268,10 @@ message(STATUS "      WITH_MAGICK       true")
 ELSE(WITH_MAGICK)
 message(STATUS "      WITH_MAGICK       false")
 ENDIF(WITH_MAGICK)
+
+IF(WITH_OPENMP) 
+SET (LIST_OPTION ${LIST_OPTION} [OPENMP]\ ) 
+message(STATUS "      WITH_OPENMP       true")
+ELSE(WITH_OPENMP)
+message(STATUS "      WITH_OPENMP       false")
+ENDIF(WITH_OPENMP)
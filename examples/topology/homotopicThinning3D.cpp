@@ -29,13 +29,13 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
-#include <queue>
 #include <QImageReader>
 #include <QtGui/qapplication.h>
 #include "DGtal/io/viewers/Viewer3D.h"
 #include "DGtal/io/DrawWithDisplay3DModifier.h"
 #include "DGtal/io/Color.h"
 #include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/HomotopicThinning.h"
 #include "DGtal/helpers/StdDefs.h"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -77,30 +77,11 @@ int main( int argc, char** argv )
   
 
   Object6_26 shape( dt6_26, shape_set );
-  int nb_simple=0; 
-  int layer = 0;
-  do 
-    {
-      DigitalSet & S = shape.pointSet();
-      std::queue<DigitalSet::Iterator> Q;
-      for ( DigitalSet::Iterator it = S.begin(); it != S.end(); ++it )
-  if ( shape.isSimple( *it ) )
-    Q.push( it );
-      nb_simple = 0;
-      while ( ! Q.empty() )
-  {
-    DigitalSet::Iterator it = Q.front();
-    Q.pop();
-    if ( shape.isSimple( *it ) )
-      {
-        cerr << "point simple " << (*it) << endl; 
-        S.erase( *it );
-        ++nb_simple;
-      }
-  }
-      ++layer;
-    }
-  while ( nb_simple != 0 );
+  HomotopicThinning<Object6_26> thinning;
+  trace.beginBlock ( "Homotopic thinning" );
+  Object6_26::Size nb_simple = thinning.thin( shape );
+  trace.info() << nb_simple << " simple points removed." << endl;
+  trace.endBlock();
 
   DigitalSet & S = shape.pointSet();
 
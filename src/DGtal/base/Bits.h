@@ -150,17 +150,75 @@ namespace DGtal
     }
 
 
+    /**
+     * Returns the index of the last (most important) set bit of val,
+     * or -1 if val is equal to 0 (T should be an unsigned type). Uses
+     * the count-leading-zeros instruction when the compiler provides
+     * it.
+     */
+    template <typename T>
+    static int mostSignificantBit(T val)
+    {
+      if ( val == 0 ) return -1;
+#if defined(__GNUC__)
+      if ( sizeof(T) <= sizeof(unsigned long long) )
+        return static_cast<int>( sizeof(unsigned long long)*8 - 1 )
+          - __builtin_clzll( static_cast<unsigned long long>( val ) );
+#endif
+      int i = -1;
+      for ( ; val; ++i) { val >>= 1; }
+      return i;
+    }
+
+
+    /**
+     * Returns the index of the first (least important) set bit of
+     * val, or -1 if val is equal to 0 (T should be an unsigned
+     * type). Uses the count-trailing-zeros instruction when the
+     * compiler provides it.
+     */
+    template <typename T>
+    static int leastSignificantBit(T val)
+    {
+      if ( val == 0 ) return -1;
+#if defined(__GNUC__)
+      if ( sizeof(T) <= sizeof(unsigned long long) )
+        return __builtin_ctzll( static_cast<unsigned long long>( val ) );
+#endif
+      int i = 0;
+      for ( ; ( val & 1 ) == 0; ++i) { val >>= 1; }
+      return i;
+    }
+
+
     /**
      * Returns the amount of set bits in val.
      */ 
     template <typename T>
     static unsigned nbSetBits(T val)
     {
+#if defined(__GNUC__)
+      // (no sign extension: unsigned types only)
+      if ( ( sizeof(T) <= sizeof(unsigned long long) )
+           && ( static_cast<T>( ~static_cast<T>( 0 ) ) > static_cast<T>( 0 ) ) )
+        return static_cast<unsigned>
+          ( __builtin_popcountll( static_cast<unsigned long long>( val ) ) );
+#endif
       unsigned i = 0;
       for ( ; val; ++i) {val ^= val & -val; }
       return i;
     }
 
+    /**
+     * Returns 'true' if the host stores its integers in
+     * little-endian order.
+     */
+    static bool isLittleEndian()
+    {
+      const unsigned short one = 1;
+      return *reinterpret_cast<const unsigned char*>( &one ) == 1;
+    }
+
 
   };//struct
 }
@@ -46,6 +46,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/shapes/ShapeBoxClassifier.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -182,6 +183,16 @@ namespace DGtal
      */
     bool operator()( const Point & p ) const;
 
+    /**
+       Classifies a digital box by classifying its embedding with
+       ShapeBoxClassifier<EuclideanShape>.
+
+       @param lower the lowest point of the box.
+       @param upper the highest point of the box.
+       @return the location of the box with respect to the digitized shape.
+    */
+    BoxLocation boxLocation( const Point & lower, const Point & upper ) const;
+
     /**
        @return the lowest admissible digital point.
        @see init
@@ -259,6 +270,17 @@ namespace DGtal
 
   }; // end of class GaussDigitizer
 
+  /**
+   * The boxes are classified by GaussDigitizer::boxLocation, which
+   * is useful only when the boxes of the Euclidean shape are.
+   */
+  template <typename TSpace, typename TEuclideanShape>
+  struct ShapeBoxClassifier< GaussDigitizer<TSpace,TEuclideanShape> >
+    : public MemberShapeBoxClassifier< GaussDigitizer<TSpace,TEuclideanShape> >
+  {
+    typedef typename ShapeBoxClassifier<TEuclideanShape>::Supported Supported;
+  };
+
 
   /**
    * Overloads 'operator<<' for displaying objects of class 'GaussDigitizer'.
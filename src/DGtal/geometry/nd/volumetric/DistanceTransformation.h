@@ -49,6 +49,7 @@
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/kernel/CSignedInteger.h"
 #include "DGtal/images/CImageContainer.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/imagesSetsUtils/ImageFromSet.h"
 #include "DGtal/geometry/nd/volumetric/SeparableMetricTraits.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
@@ -86,6 +87,25 @@ namespace DGtal
    * DTl2::OutputImage result = dt.compute(image);
    *
    * @endcode  
+   *
+   * Each 1D row of a given step is independent from the others. When
+   * DGtal is built with OpenMP (WITH_OPENMP cmake option), the rows
+   * can be distributed among several threads, each thread owning its
+   * own lower envelope stacks (see setNumberOfThreads). The result is
+   * exactly the same as the one of the serial computation. In that
+   * case, the input image must support concurrent read accesses.
+   *
+   * The 1D scans work on strided raw pointers in the
+   * (ImageContainerBySTLVector) output buffers. If the input image
+   * is also an ImageContainerBySTLVector and the default foreground
+   * predicate is used, the first step reads the input values
+   * directly from its buffer.
+   *
+   * For the steps along dimensions greater than 0, the 1D columns are
+   * not contiguous in memory. They are processed by tiles of adjacent
+   * columns (see setTileSize): a tile is copied into a small
+   * contiguous scratch buffer, the lower envelope scans are performed
+   * on each column of the tile and the result is written back.
    */
   template <typename Image, DGtal::uint32_t p, typename IntegerLong = DGtal::int64_t >
   class DistanceTransformation
@@ -103,6 +123,10 @@ namespace DGtal
     typedef typename Image::Value Value;
     typedef typename Image::Vector Vector;
     typedef typename Image::Point Point;
+
+    ///Type of the image of closest background points (Voronoi map)
+    typedef ImageContainerBySTLVector<  HyperRectDomain<typename Image::Domain::Space> , Point > VoronoiMap;
+
     typedef typename Image::Dimension Dimension;
     typedef typename Image::Size Size;
     typedef typename Image::Domain Domain;
@@ -122,6 +146,36 @@ namespace DGtal
      */
     ~DistanceTransformation();
 
+    /**
+     * Set the number of threads used to process the 1D rows of each
+     * step (default: 1, serial computation). This parameter is
+     * ignored if DGtal has not been built with OpenMP.
+     *
+     * @param nbThreads the number of threads (0 means the OpenMP
+     * default, i.e. usually the number of cores).
+     */
+    void setNumberOfThreads(const unsigned int nbThreads);
+
+    /**
+     * @return the number of threads used to process the 1D rows.
+     */
+    unsigned int numberOfThreads() const;
+
+    /**
+     * Set the number of adjacent columns processed together in the
+     * steps along dimensions greater than 0 (default: 16). A value
+     * lower than 2 disables the tiling: the columns are then scanned
+     * directly in the image buffers.
+     *
+     * @param tileSize the number of columns of a tile.
+     */
+    void setTileSize(const unsigned int tileSize);
+
+    /**
+     * @return the number of adjacent columns processed together.
+     */
+    unsigned int tileSize() const;
+
 
     // ------- Private Functor to be used as a default template ----
 
@@ -182,6 +236,34 @@ namespace DGtal
      */
     template <typename ForegroundPredicate>
     OutputImage compute(const Image & inputImage, const ForegroundPredicate & predicate  );
+
+    /**
+     * Compute the first @a nbSteps steps of the separable distance
+     * transformation: each point with value satisfying the foreground
+     * predicate gets its distance to the closest background point
+     * among the points that differ from it only by the first @a
+     * nbSteps coordinates (e.g. in its row for one step), or
+     * infinity() if there is none. With nbSteps equal to the
+     * dimension, this is compute(). As the subspaces are independent,
+     * an image cut into slabs along the last dimension may be
+     * processed slab by slab when nbSteps is lower than the dimension.
+     *
+     * @param inputImage the input image
+     * @param foregroundPredicate a predicate to detect foreground
+     * point from the image valuetype
+     * @param nbSteps the number of steps (between 1 and the dimension).
+     * @return the partial distance transformation image with the
+     * Internal format.
+     */
+    template <typename ForegroundPredicate>
+    OutputImage computePartial(const Image & inputImage, const ForegroundPredicate & predicate,
+             const Dimension nbSteps );
+
+    /**
+     * @return the value given to the points without background point
+     * in the last computation (it depends on the extent of the image).
+     */
+    IntegerLong infinity() const;
     
     /**
      * Compute the Distance Transformation of an image with the SeparableMetric metric.
@@ -198,6 +280,22 @@ namespace DGtal
       return compute<DefaultForegroundPredicate>(inputImage, DefaultForegroundPredicate());
     };
 
+    /**
+     * Compute the first @a nbSteps steps of the separable distance
+     * transformation with the default foreground predicate (values
+     * different from zero), see computePartial above.
+     *
+     * @param inputImage the input image
+     * @param nbSteps the number of steps (between 1 and the dimension).
+     * @return the partial distance transformation image with the
+     * Internal format.
+     */
+    OutputImage computePartial(const Image & inputImage, const Dimension nbSteps )
+    {
+      return computePartial<DefaultForegroundPredicate>(inputImage, DefaultForegroundPredicate(),
+               nbSteps);
+    };
+
     /**
      * Compute the Distance Transformation of a Set with the SeparableMetric metric.
      * This method first converts the digital set of an image and
@@ -217,6 +315,51 @@ namespace DGtal
     template<typename DigitalSet>
     OutputImage compute(const DigitalSet & inputSet, const bool addBoundary=true );
 
+    /**
+     * Compute the feature transformation of an image with the
+     * SeparableMetric metric, i.e. the Voronoi map of the background
+     * points: the method associates to each point its closest
+     * background point (site), background points being their own
+     * sites. The sites are obtained from the lower envelope stacks of
+     * the separable algorithm, in O(d.|inputImage|).
+     *
+     * Points of an image without any background point are associated
+     * to the point upperBound() + (1,...,1), which lies outside the
+     * image domain.
+     *
+     * Only the Voronoi maps are stored during the computation, the
+     * partial distances are recomputed from the sites. The distance
+     * image is built at the end if @a distanceImage is not NULL.
+     *
+     * @param inputImage the input image
+     * @param predicate a predicate to detect foreground point from the
+     * image valuetype
+     * @param distanceImage if not NULL, the distance transformation
+     * image (same values as compute()) is copied into this image.
+     * @return the Voronoi map.
+     */
+    template <typename ForegroundPredicate>
+    VoronoiMap computeVoronoiMap(const Image & inputImage, 
+         const ForegroundPredicate & predicate,
+         OutputImage * distanceImage = NULL );
+
+    /**
+     * Compute the feature transformation (Voronoi map) of an image
+     * with the SeparableMetric metric, the foreground being the points
+     * with non-zero values.
+     *
+     * @param inputImage the input image
+     * @param distanceImage if not NULL, the distance transformation
+     * image (same values as compute()) is copied into this image.
+     * @return the Voronoi map.
+     */
+    VoronoiMap computeVoronoiMap(const Image & inputImage,
+         OutputImage * distanceImage = NULL )
+    {
+      return computeVoronoiMap<DefaultForegroundPredicate>(inputImage, 
+                       DefaultForegroundPredicate(),
+                       distanceImage);
+    };
    
 
     // ------------------- Private functions ------------------------
@@ -237,17 +380,49 @@ b     * @param aImage the input image
      * Compute the 1D DT associated to the first step.
      * 
      * @param aImage the input image
-     * @param output the output image  with the first step DT values
+     * @param output pointer to the first value of the 1D row in the
+     * output image buffer (the row is contiguous).
+     * @param offset linearized index of the starting point of the 1D row
      * @param startingPoint a point to specify the starting point of the 1D row
      * @param predicate  the predicate to characterize the foreground
      * (e.g. !=0, see DefaultForegroundPredicate)
      */
     template <typename ForegroundPredicate>
     void computeFirstStep1D (const Image & aImage, 
-           OutputImage & output, 
+           IntegerLong *output, 
+           const Size offset,
            const Point &startingPoint, 
            const ForegroundPredicate &predicate) const;
 
+    /** 
+     * Initialize a 1D row of the first step: foreground points are
+     * set to myInfinity, background points to 0.
+     * 
+     * @param aImage the input image
+     * @param output pointer to the first value of the 1D row in the
+     * output image buffer.
+     * @param offset linearized index of the starting point of the 1D row
+     * @param startingPoint a point to specify the starting point of the 1D row
+     * @param predicate  the predicate to characterize the foreground
+     */
+    template <typename ForegroundPredicate>
+    void initFirstStep1D (const Image & aImage, 
+        IntegerLong *output, 
+        const Size offset,
+        const Point &startingPoint, 
+        const ForegroundPredicate &predicate) const;
+
+    /** 
+     * Specialization of initFirstStep1D for the default foreground
+     * predicate: if the input image stores its values in a
+     * linearized buffer, the values are read directly from it.
+     */
+    void initFirstStep1D (const Image & aImage, 
+        IntegerLong *output, 
+        const Size offset,
+        const Point &startingPoint, 
+        const DefaultForegroundPredicate &predicate) const;
+
     /** 
      *  Compute the other steps of the separable distance transformation.
      * 
@@ -258,20 +433,87 @@ b     * @param aImage the input image
      */    
     void computeOtherSteps(const OutputImage & inputImage, OutputImage & output, const Dimension dim)const;
 
+    /** 
+     *  Compute the other steps of the separable distance
+     *  transformation, processing the columns by tiles of
+     *  myTileSize adjacent columns.
+     * 
+     * @param inputImage the image resulting of the first (or
+     * intermediate) step 
+     * @param output the output image 
+     * @param dim the dimension to process (greater than 0)
+     */    
+    void computeOtherStepsTiled(const OutputImage & inputImage, OutputImage & output, const Dimension dim)const;
+
     /** 
      * Compute the 1D DT associated to the steps except the first one.
      * 
-     * @param aImage the input image
-     * @param output the output image  with the  DT values
-     * @param row a point to specify the starting point of the 1D row
+     * @param input pointer to the first value of the 1D row in the
+     * input buffer.
+     * @param output pointer to the first value of the 1D row in the
+     * output buffer.
+     * @param stride distance (in number of values) between two
+     * consecutive values of the 1D row in both buffers.
      * @param dim the dimension to process
-     * @param predicate  the predicate to characterize the foreground
-     * (e.g. !=0, see DefaultForegroundPredicate)
+     * @param s stack of the lower envelope abscissas.
+     * @param t stack of the lower envelope separators.
      */
-    void computeOtherStep1D (const OutputImage & input, OutputImage & output, 
-           const Point &row, const Size dim, 
+    void computeOtherStep1D (const IntegerLong *input, IntegerLong *output, 
+           const Size stride, const Size dim, 
            Abscissa s[], Abscissa t[]) const;
 
+    /** 
+     * Compute the first step of the feature transformation.
+     * 
+     * @param aImage the input image
+     * @param output the Voronoi map along dimension 0
+     * @param predicate the predicate to characterize the foreground
+     */
+    template <typename ForegroundPredicate>
+    void computeFirstStepVoronoi(const Image & aImage, VoronoiMap & output, 
+         const ForegroundPredicate &predicate) const;
+
+    /** 
+     * Compute the other steps of the feature transformation.
+     * 
+     * @param input the Voronoi map of the previous step.
+     * @param output the Voronoi map of the current step.
+     * @param dim the dimension to process
+     */
+    void computeOtherStepsVoronoi(const VoronoiMap & input, VoronoiMap & output, 
+          const Dimension dim) const;
+
+    /** 
+     * Compute the 1D feature transformation associated to the steps
+     * except the first one.
+     * 
+     * @param input pointer to the first site of the 1D row in the
+     * input buffer.
+     * @param output pointer to the first site of the 1D row in the
+     * output buffer.
+     * @param stride distance (in number of values) between two
+     * consecutive values of the 1D row in both buffers.
+     * @param row the starting point of the 1D row.
+     * @param dim the dimension to process
+     * @param s stack of the lower envelope abscissas.
+     * @param t stack of the lower envelope separators.
+     */
+    void computeOtherStepVoronoi1D (const Point *input, Point *output, 
+            const Size stride, const Point &row,
+            const Dimension dim, 
+            Abscissa s[], Abscissa t[]) const;
+
+    /** 
+     * @param aPoint a point of the translated domain.
+     * @param aSite a site of the translated domain (or myNoSite).
+     * @param dim the number of dimensions to consider.
+     * @return the distance (power p) between @a aPoint and @a aSite
+     * restricted to the dimensions lower than @a dim, or myInfinity
+     * if @a aSite is myNoSite.
+     */
+    IntegerLong partialDistance(const Point &aPoint, const Point &aSite, 
+        const Dimension dim) const;
+
 
     // ------------------- Private members ------------------------
   private:
@@ -294,6 +536,15 @@ b     * @param aImage the input image
     ///Value to act as a +infinity value
     IntegerLong myInfinity;
 
+    ///Site associated to points without any background point
+    Point myNoSite;
+
+    ///Number of threads used to process the 1D rows
+    unsigned int myNbThreads;
+
+    ///Number of adjacent columns processed together
+    unsigned int myTileSize;
+
 
   }; // end of class DistanceTransformation
 
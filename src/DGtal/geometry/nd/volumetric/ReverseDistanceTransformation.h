@@ -45,6 +45,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/images/CImageContainer.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/geometry/nd/volumetric/SeparableMetricTraits.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
@@ -70,6 +71,15 @@ namespace DGtal
    * @tparam p the static integer value to define the l_p metric.
    * @tparam IntegerShort (optional) type used to represent the output
    * object values (default: DGtal::int8_t).xs
+   *
+   * If the Image type stores its values in a linearized buffer
+   * (ImageContainerBySTLVector), the 1D scans work on strided raw
+   * pointers, and the steps along dimensions greater than 0 process
+   * tiles of adjacent columns copied into a contiguous scratch buffer
+   * (see setTileSize). When DGtal is built with OpenMP (WITH_OPENMP
+   * cmake option), these tiles can be distributed among several
+   * threads (see setNumberOfThreads), with the same result as the
+   * serial computation.
    */
   template <typename Image, DGtal::uint32_t p, typename IntegerShort = DGtal::int8_t >
   class ReverseDistanceTransformation
@@ -113,6 +123,36 @@ namespace DGtal
      */
     ~ReverseDistanceTransformation();
 
+    /**
+     * Set the number of threads used to process the tiles of the
+     * steps along dimensions greater than 0 (default: 1, serial
+     * computation). This parameter is ignored if DGtal has not been
+     * built with OpenMP.
+     *
+     * @param nbThreads the number of threads (0 means the OpenMP
+     * default, i.e. usually the number of cores).
+     */
+    void setNumberOfThreads(const unsigned int nbThreads);
+
+    /**
+     * @return the number of threads used to process the tiles.
+     */
+    unsigned int numberOfThreads() const;
+
+    /**
+     * Set the number of adjacent columns processed together in the
+     * steps along dimensions greater than 0 (default: 16). A value
+     * lower than 2 disables the tiling.
+     *
+     * @param tileSize the number of columns of a tile.
+     */
+    void setTileSize(const unsigned int tileSize);
+
+    /**
+     * @return the number of adjacent columns processed together.
+     */
+    unsigned int tileSize() const;
+
   public:
 
     /**
@@ -193,6 +233,36 @@ namespace DGtal
        const Size dim, 
        Integer s[], Integer t[]) const;
 
+    /** 
+     * Compute the 1D reverse DT on raw buffers.
+     * 
+     * @param input pointer to the first value of the 1D row in the
+     * input buffer.
+     * @param output pointer to the first value of the 1D row in the
+     * output buffer.
+     * @param stride distance (in number of values) between two
+     * consecutive values of the 1D row in both buffers.
+     * @param dim the dimension to process
+     */
+    void computeSteps1D (const Value *input, 
+       Value *output, 
+       const Size stride, 
+       const Size dim, 
+       Integer s[], Integer t[]) const;
+
+    /** 
+     * Compute the steps along dimensions greater than 0 on raw
+     * buffers, processing the columns by tiles of myTileSize adjacent
+     * columns.
+     * 
+     * @param input the input buffer.
+     * @param output the output buffer.
+     * @param dim the dimension to process (greater than 0)
+     */
+    void computeStepsTiled (const Value *input, 
+          Value *output, 
+          const Dimension dim) const;
+
 
     // ------------------- Private members ------------------------
   private:
@@ -217,6 +287,12 @@ namespace DGtal
     ///Value for background grid points.
     IntegerShort myBackgroundValue;
 
+    ///Number of threads used by the tiled steps
+    unsigned int myNbThreads;
+
+    ///Number of adjacent columns processed together
+    unsigned int myTileSize;
+
   }; // end of class ReverseDistanceTransformation
 
 } // namespace DGtal
@@ -0,0 +1,424 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HashTreeStorage.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/09
+ *
+ * Header file for module HashTreeStorage.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HashTreeStorage_RECURSES)
+#error Recursive header files inclusion detected in HashTreeStorage.h
+#else // defined(HashTreeStorage_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HashTreeStorage_RECURSES
+
+#if !defined HashTreeStorage_h
+/** Prevents repeated inclusion of headers. */
+#define HashTreeStorage_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace experimental
+  {
+
+    /////////////////////////////////////////////////////////////////////////////
+    // template class HashTreeNode
+    /**
+     * Description of template class 'HashTreeNode' <p>
+     * @brief Node of an ImageContainerByHashTree: a pair (value,key)
+     * plus a pointer to the next node of the same bucket (only used
+     * by the chained storage, always 0 otherwise).
+     *
+     * @tparam TValue type for image values
+     * @tparam THashKey type to store Morton keys
+     */
+    template <typename TValue, typename THashKey>
+    class HashTreeNode
+    {
+    public:
+      typedef TValue Value;
+      typedef THashKey HashKey;
+
+      /**
+       * Construtctor: create pair (@a aValue, @a key)
+       *
+       * @param aValue  First value
+       * @param key     key in the hashtree
+       */
+      HashTreeNode(Value aValue, HashKey key)
+	: myKey( key ), myNext( 0 ), myData( aValue )
+      {}
+
+      /**
+       * @return the next pair (aValue, key) in the list.
+       */
+      inline HashTreeNode* getNext()
+      {
+	return myNext;
+      }
+
+      /**
+       * Insert the pair (value,key)  @a next in the node list
+       *
+       * @param next a pointer to a pair (value,key) (Node).
+       */
+      inline void setNext(HashTreeNode* next)
+      {
+	myNext = next;
+      }
+
+      /**
+       * @return the key associated to a Node.
+       */
+      inline HashKey getKey()
+      {
+	return myKey;
+      }
+
+      /**
+       * @return the object (aValue) associated to a Node.
+       */
+      inline Value& getObject()
+      {
+	return myData;
+      }
+
+    protected:
+      HashKey myKey;
+      HashTreeNode* myNext;
+      Value myData;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////
+    // template class ChainedHashTreeStorage
+    /**
+     * Description of template class 'ChainedHashTreeStorage' <p>
+     * @brief Node storage of an ImageContainerByHashTree as an array
+     * of @f$2^K@f$ linked lists of heap allocated nodes, the list
+     * being selected by the K least important bits of the key (default
+     * storage).
+     *
+     * A node storage provides the following services to the
+     * container: getNode, addNode, removeNode, getNbNodes, and, for
+     * the iterators and the statistics, getArraySize and cell(i) which
+     * returns the first node stored in the i-th cell of the table
+     * (subsequent nodes of the cell are obtained with
+     * HashTreeNode::getNext()).
+     *
+     * @tparam TValue type for image values
+     * @tparam THashKey type to store Morton keys
+     */
+    template <typename TValue, typename THashKey>
+    class ChainedHashTreeStorage
+    {
+    public:
+      typedef TValue Value;
+      typedef THashKey HashKey;
+      typedef HashTreeNode<Value, HashKey> Node;
+
+      /**
+       * Constructor.
+       * @param hashKeySize number K of bits of the intermediate key
+       * (the table has @f$2^K@f$ cells).
+       */
+      ChainedHashTreeStorage( const unsigned int hashKeySize );
+
+      /**
+       * Destructor. Deletes all the nodes.
+       */
+      ~ChainedHashTreeStorage();
+
+      /**
+       * Returns a pointer to the node corresponding to the key. If it
+       * does'nt exist, returns 0.
+       * @param key The key.
+       * @return the pointer to the node corresponding to the key.
+       */
+      inline Node* getNode( const HashKey key ) const
+      {
+	Node* iter = myData[ key & myPreComputedIntermediateMask ];
+	while ( iter != 0 )
+	  {
+	    if ( iter->getKey() == key )
+	      return iter;
+	    iter = iter->getNext();
+	  }
+	return 0;
+      }
+
+      /**
+       * Adds (or updates) the node (@a object, @a key).
+       * @param object a object (value)
+       * @param key a hashtree key
+       * @return a pointer to the node.
+       */
+      Node* addNode( const Value object, const HashKey key );
+
+      /**
+       * Removes the node corresponding to a key.
+       * @param key The key
+       * @return false if the node doesn't exist.
+       */
+      bool removeNode( const HashKey key );
+
+      /**
+       * @return the number of nodes.
+       */
+      unsigned int getNbNodes() const
+      {
+	return myNbNodes;
+      }
+
+      /**
+       * @return the number of cells of the table.
+       */
+      unsigned int getArraySize() const
+      {
+	return myArraySize;
+      }
+
+      /**
+       * @param i a cell index (less than getArraySize()).
+       * @return the first node of the i-th cell (0 if empty).
+       */
+      Node* cell( const unsigned int i ) const
+      {
+	return myData[ i ];
+      }
+
+      /**
+       * @return the memory used by the table and the nodes (in bytes).
+       */
+      std::size_t memoryUsage() const
+      {
+	return myArraySize * sizeof( Node* ) + myNbNodes * sizeof( Node );
+      }
+
+    private:
+      ChainedHashTreeStorage( const ChainedHashTreeStorage & other );
+      ChainedHashTreeStorage & operator=( const ChainedHashTreeStorage & other );
+
+      /**
+       * The array of linked lists containing all the data
+       */
+      Node** myData;
+      unsigned int myArraySize;
+      unsigned int myNbNodes;
+      HashKey myPreComputedIntermediateMask; // ~((~0) << _keySize)
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////
+    // template class OpenAddressingHashTreeStorage
+    /**
+     * Description of template class 'OpenAddressingHashTreeStorage' <p>
+     * @brief Node storage of an ImageContainerByHashTree as a flat
+     * open addressing (linear probing) table of (key, node) pairs,
+     * the nodes being allocated by blocks in an arena.
+     *
+     * Compared to ChainedHashTreeStorage, a missing key (the common
+     * case when ImageContainerByHashTree::get walks up the tree) is
+     * detected without dereferencing any node, the nodes are not
+     * individually allocated on the heap and the removed ones are
+     * recycled. The table is a power of two
+     * which doubles when its load factor exceeds 3/4 (so the pointers
+     * to nodes stay valid but the iterators are invalidated by an
+     * insertion). Removal uses backward shift deletion (no
+     * tombstones).
+     *
+     * @tparam TValue type for image values
+     * @tparam THashKey type to store Morton keys (the key 0, invalid
+     * in a hash tree, is not allowed).
+     *
+     * @see ChainedHashTreeStorage for the services.
+     */
+    template <typename TValue, typename THashKey>
+    class OpenAddressingHashTreeStorage
+    {
+    public:
+      typedef TValue Value;
+      typedef THashKey HashKey;
+      typedef HashTreeNode<Value, HashKey> Node;
+
+      /**
+       * Constructor.
+       * @param hashKeySize number K of bits of the initial table size
+       * (the table has @f$2^K@f$ cells, at least 16).
+       */
+      OpenAddressingHashTreeStorage( const unsigned int hashKeySize );
+
+      /**
+       * Destructor. Destroys all the nodes and releases the arena.
+       */
+      ~OpenAddressingHashTreeStorage();
+
+      /**
+       * Returns a pointer to the node corresponding to the key. If it
+       * does'nt exist, returns 0.
+       * @param key The key.
+       * @return the pointer to the node corresponding to the key.
+       */
+      inline Node* getNode( const HashKey key ) const
+      {
+	unsigned int i = slotIndex( key );
+	while ( mySlots[ i ].node != 0 )
+	  {
+	    if ( mySlots[ i ].key == key )
+	      return mySlots[ i ].node;
+	    i = ( i + 1 ) & myMask;
+	  }
+	return 0;
+      }
+
+      /**
+       * Adds (or updates) the node (@a object, @a key).
+       * @param object a object (value)
+       * @param key a hashtree key
+       * @return a pointer to the node.
+       */
+      Node* addNode( const Value object, const HashKey key );
+
+      /**
+       * Removes the node corresponding to a key.
+       * @param key The key
+       * @return false if the node doesn't exist.
+       */
+      bool removeNode( const HashKey key );
+
+      /**
+       * @return the number of nodes.
+       */
+      unsigned int getNbNodes() const
+      {
+	return myNbNodes;
+      }
+
+      /**
+       * @return the number of cells of the table.
+       */
+      unsigned int getArraySize() const
+      {
+	return static_cast<unsigned int>( mySlots.size() );
+      }
+
+      /**
+       * @param i a cell index (less than getArraySize()).
+       * @return the node of the i-th cell (0 if empty).
+       */
+      Node* cell( const unsigned int i ) const
+      {
+	return mySlots[ i ].node;
+      }
+
+      /**
+       * @return the memory used by the table and the arena (in bytes).
+       */
+      std::size_t memoryUsage() const
+      {
+	return mySlots.size() * sizeof( Slot )
+	  + myBlocks.size() * BlockSize * sizeof( Node );
+      }
+
+    private:
+      OpenAddressingHashTreeStorage( const OpenAddressingHashTreeStorage & other );
+      OpenAddressingHashTreeStorage & operator=( const OpenAddressingHashTreeStorage & other );
+
+      /// A cell of the table: the key is duplicated to avoid
+      /// dereferencing the node while probing.
+      struct Slot
+      {
+	HashKey key;
+	Node* node;
+      };
+
+      /// Number of nodes per block of the arena.
+      static const unsigned int BlockSize = 4096;
+
+      /**
+       * Multiplicative (Fibonacci) hashing of the key: the Morton keys
+       * of neighbouring nodes only differ in their low bits.
+       * @param key a hashtree key.
+       * @return the first cell to probe.
+       */
+      inline unsigned int slotIndex( const HashKey key ) const
+      {
+	return static_cast<unsigned int>
+	  ( ( static_cast<DGtal::uint64_t>( key ) * 0x9E3779B97F4A7C15ULL )
+	    >> myShift ) & myMask;
+      }
+
+      /**
+       * Resizes the table to @a newSize cells (a power of two) and
+       * reinserts the (key, node) pairs.
+       * @param newSize the new number of cells.
+       */
+      void rehash( const unsigned int newSize );
+
+      /**
+       * @return a node taken from the released ones or from the arena.
+       */
+      Node* allocateNode( const Value object, const HashKey key );
+
+      /**
+       * Destroys a node and keeps its memory for later allocations.
+       */
+      void releaseNode( Node* node );
+
+      std::vector<Slot> mySlots;
+      unsigned int myMask;
+      unsigned int myShift;
+      unsigned int myNbNodes;
+
+      /// Blocks of BlockSize nodes (raw memory).
+      std::vector<Node*> myBlocks;
+      /// Number of nodes used in the last block.
+      unsigned int myBlockUsed;
+      /// Released nodes, reused before taking new ones in the arena.
+      std::vector<Node*> myFreeNodes;
+    };
+
+  } // namespace experimental
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/HashTreeStorage.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HashTreeStorage_h
+
+#undef HashTreeStorage_RECURSES
+#endif // else defined(HashTreeStorage_RECURSES)
@@ -48,6 +48,7 @@
 #include "DGtal/base/Bits.h"
 #include "DGtal/io/boards/Board2D.h"
 #include "DGtal/images/Morton.h"
+#include "DGtal/images/HashTreeStorage.h"
 #include "DGtal/io/Color.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -109,20 +110,29 @@ namespace DGtal
      * The method isKeyValid(..) is provided to verify the validity of a
      * key. Note that using this security strongly affects performances.
      *
+     * The nodes are stored by a node storage policy: by default
+     * (ChainedHashTreeStorage) in an array of linked lists of heap
+     * allocated nodes, or (OpenAddressingHashTreeStorage) in a flat
+     * open addressing table with nodes allocated in an arena, which is
+     * faster and lighter for trees with many nodes.
+     *
      * @tparam TDomain type of domains
      * @tparam TValue type for image values
      * @taparam THashKey  type to store Morton keys
      * (default: DGtal::uint64_t)
+     * @tparam TStorage node storage policy (default:
+     * ChainedHashTreeStorage<TValue, THashKey>).
      * 
      * @see testImageContainerByHashTree.cpp
      *       
      * */
-    template < typename TDomain, typename TValue, typename THashKey = typename DGtal::uint64_t >
+    template < typename TDomain, typename TValue, typename THashKey = typename DGtal::uint64_t,
+	       typename TStorage = ChainedHashTreeStorage<TValue, THashKey> >
     class ImageContainerByHashTree
     {
 
     protected:
-      class Node;
+      typedef typename TStorage::Node Node;
       template <int X, unsigned int exponent> struct POW;
 
 
@@ -134,6 +144,7 @@ namespace DGtal
       typedef THashKey HashKey;
       typedef TValue Value;
       typedef TDomain Domain;
+      typedef TStorage Storage;
       typedef typename Domain::Point Point;
       typedef typename Domain::Vector Vector;
 
@@ -282,6 +293,28 @@ namespace DGtal
        */
       void setValue(const Point& aPoint, const Value object);
 
+      /**
+       * Replaces the content of the container by the values of a
+       * dense image. Instead of calling setValue for each point
+       * (which splits and merges nodes), the tree is built bottom-up
+       * in Morton order in a single pass: an octant whose 2^dim
+       * children are leafs with the same value becomes a leaf, so
+       * the resulting tree is compact and each node is inserted
+       * once.
+       *
+       * The points of the tree span (from the origin of the container
+       * to origin + getSpanSize()) which are not in the image domain
+       * get the value @a outsideValue.
+       *
+       * @param anImage any model of CImageContainer with the same
+       * Point type and values convertible to Value (e.g. the result
+       * of VolReader::importVol).
+       * @param outsideValue the value outside the image domain.
+       * @tparam TImage type of the image.
+       */
+      template <typename TImage>
+      void buildFromImage(const TImage & anImage, const Value outsideValue = Value());
+
       /**
        * Returns the size of a dimension (the container represents a
        * line, a square, a cube, etc. depending on the dimmension so no
@@ -416,15 +449,15 @@ namespace DGtal
       class Iterator
       {
       public:
-	Iterator(Node** data, unsigned int position, unsigned int arraySize)
+	Iterator(const Storage* storage, unsigned int position)
 	{
-	  myArraySize = arraySize;
-	  myContainerData = data;
-	  myNode = data[0];
+	  myStorage = storage;
+	  myArraySize = storage->getArraySize();
 	  myCurrentCell = position;
-	  while ((!myNode) && (myCurrentCell < myArraySize))
+	  myNode = (myCurrentCell < myArraySize) ? storage->cell(myCurrentCell) : 0;
+	  while ((!myNode) && (++myCurrentCell < myArraySize))
 	    {
-	      myNode = myContainerData[++myCurrentCell];
+	      myNode = myStorage->cell(myCurrentCell);
 	    }
 	}
 	bool isAtEnd()const
@@ -462,7 +495,7 @@ namespace DGtal
 	Node* myNode;
 	unsigned int myCurrentCell;
 	unsigned int myArraySize;
-	Node** myContainerData;
+	const Storage* myStorage;
       };
 
       /**
@@ -470,7 +503,7 @@ namespace DGtal
        */
       Iterator begin()
       {
-	return Iterator(myData, 0, myArraySize);
+	return Iterator(&myStorage, 0);
       }
 
       /**
@@ -478,7 +511,7 @@ namespace DGtal
        */
       Iterator end()
       {
-	return Iterator(myData, myArraySize, myArraySize);
+	return Iterator(&myStorage, myStorage.getArraySize());
       }
 
       void selfDisplay(std::ostream & out);
@@ -529,71 +562,6 @@ namespace DGtal
       recursiveDraw(HashKey key, const double p1[2], const double len, LibBoard::Board & board, const C& cmap) const;
 
 
-      // -------------------------------------------------------------
-      /**
-       * @class Node
-       *
-       * An internal class that corresponds to a node of a linked list (as the hashTable points to linked
-       * lists to handle collisions). Each element in the container is placed in a Node.
-       */
-      class Node
-      {
-      public:
-
-	/** 
-	 * Construtctor: create pair (@a aValue, @a key)
-	 * 
-	 * @param aValue  First value
-	 * @param key     key in the hashtree 
-	 */
-	Node(Value aValue, HashKey key)
-	{
-	  myData = aValue;
-	  myKey = key;
-	}
-
-	/** 
-	 * @return the next pair (aValue, key) in the list.
-	 */
-	inline Node* getNext()
-	{
-	  return myNext;
-	}
-
-
-	/** 
-	 * Insert the pair (value,key)  @a next in the node list 
-	 * 
-	 * @param next a pointer to a pair (value,key) (Node).
-	 */	
-	inline void setNext(Node* next)
-	{
-	  myNext = next;
-	}
-
-	/** 
-	 * 
-	 * @return the key associated to a Node. 
-	 */
-	inline HashKey getKey()
-	{
-	  return myKey;
-	}
-	
-	/** 
-	 * 
-	 * @return the object (aValue) associated to a Node.
-	 */
-	inline Value& getObject()
-	{
-	  return myData;
-	}
-	~Node() { }
-      protected:
-	HashKey myKey;
-	Node* myNext;
-	Value myData;
-      };// -----------------------------------------------------------
 
 
         /**
@@ -631,18 +599,7 @@ namespace DGtal
        */
       Node* addNode(const Value object, const HashKey key)
       {
-	Node* n = getNode(key);
-	if (n)
-          {
-            n->getObject() = object;
-            //n->setObject(object);
-            return n;
-          }
-	n = new Node(object, key);
-	HashKey key2 = getIntermediateKey(key);
-	n->setNext(myData[key2]);
-	myData[key2] = n;
-	return n;
+	return myStorage.addNode(object, key);
       }
 
       /**
@@ -654,14 +611,7 @@ namespace DGtal
        */
       inline Node* getNode(const HashKey key)  const  // very used !!
       {
-	Node* iter = myData[getIntermediateKey(key)];
-	while (iter != 0)
-          {
-            if (iter->getKey() == key)
-              return iter;
-            iter = iter->getNext();
-          }
-	return 0;
+	return myStorage.getNode(key);
       }
 
       /**
@@ -696,9 +646,30 @@ namespace DGtal
       Value blendChildren(HashKey key) const;
 
       /**
-       * The array of linked lists containing all the data
+       * Recursive step of buildFromImage. Computes the sub-tree of the
+       * octant @a key and adds the leafs of its non-uniform
+       * descendants to the storage.
+       *
+       * @param anImage the image.
+       * @param lower lower bound of the image domain.
+       * @param upper upper bound of the image domain.
+       * @param key the key of the octant.
+       * @param corner the lowest point of the octant.
+       * @param side the size of the octant.
+       * @param outsideValue the value outside the image domain.
+       * @param value (returns) the value of the octant if uniform.
+       * @return true if the octant is uniform (not yet added as a
+       * leaf, the caller decides).
+       */
+      template <typename TImage>
+      bool buildSubTree(const TImage & anImage, const Point & lower, const Point & upper,
+			const HashKey key, const Point & corner, const unsigned int side,
+			const Value outsideValue, Value & value);
+
+      /**
+       * The node storage containing all the data
        */
-      Node** myData;
+      Storage myStorage;
 
       /**
        * The size of the intermediate hashkey. The bigger the less
@@ -707,8 +678,6 @@ namespace DGtal
        */
       unsigned int myKeySize;
 
-      unsigned int myArraySize;
-
       /**
        * The depth of the tree
        */
@@ -735,9 +704,9 @@ namespace DGtal
      * @param object the object of class 'ImageContainerByHashTree' to write.
      * @return the output stream after the writing.
      */
-    template<typename TDomain, typename TValue, typename THashKey >
+    template<typename TDomain, typename TValue, typename THashKey, typename TStorage >
     std::ostream&
-    operator<< ( std::ostream & out,  ImageContainerByHashTree<TDomain, TValue, THashKey> & object )
+    operator<< ( std::ostream & out,  ImageContainerByHashTree<TDomain, TValue, THashKey, TStorage> & object )
     {
       object.selfDisplay( out);
       return out;
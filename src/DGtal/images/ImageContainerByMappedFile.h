@@ -0,0 +1,529 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByMappedFile.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/20
+ *
+ * Header file for module ImageContainerByMappedFile.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByMappedFile_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByMappedFile.h
+#else // defined(ImageContainerByMappedFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByMappedFile_RECURSES
+
+#if !defined ImageContainerByMappedFile_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByMappedFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/images/CValue.h"
+#include "DGtal/kernel/domains/CDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByMappedFile
+  /**
+   * Description of template class 'ImageContainerByMappedFile' <p>
+   * \brief Aim: Model of CImageContainer whose values are the
+   * payload of a file (e.g. a vol, longvol or raw file), mapped in
+   * memory instead of being read.
+   *
+   * The payload stores the values in the linearized order of the
+   * domain (first dimension first), each value on sizeof(Value)
+   * bytes in little-endian order. Opening the image is immediate,
+   * whatever the size of the file: only the pages of the file that
+   * are accessed are read by the system.
+   *
+   * The mapping is private: setValue changes the values of the image
+   * but never the file itself. Copies of an image share the same
+   * mapping (and thus the same values). On systems without mmap
+   * (WIN32), the payload is read in memory when the image is built.
+   *
+   * Such images are usually built by the readers:
+   * @code
+   * typedef ImageContainerByMappedFile<Z3i::Domain, unsigned char> Image;
+   * Image image = VolReader<Image>::mapVol( "data.vol" );
+   * for ( Image::SpanIterator it = image.spanBegin( p, 2 ),
+   *         itend = image.spanEnd( p, 2 ); it != itend; ++it )
+   *   sum += *it;
+   * @endcode
+   *
+   * @tparam TDomain the domain type (an HyperRectDomain).
+   * @tparam TValue the value type.
+   *
+   * @see VolReader, LongvolReader, RawReader
+   * @see testImageContainerByMappedFile.cpp
+   */
+  template <typename TDomain, typename TValue>
+  class ImageContainerByMappedFile
+  {
+  public:
+
+    BOOST_CONCEPT_ASSERT(( CValue<TValue> ));
+    BOOST_CONCEPT_ASSERT(( CDomain<TDomain> ));
+
+    typedef TValue Value;
+    typedef TDomain Domain;
+
+    // static constants
+    static const typename Domain::Dimension dimension = Domain::dimension;
+
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Dimension Dimension;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+
+    /**
+     * Iterator on the values of the image, in the linearized order.
+     * Dereferencing it decodes the value in place.
+     */
+    class Iterator
+    {
+      friend class ImageContainerByMappedFile<Domain, Value>;
+
+    public:
+      typedef std::bidirectional_iterator_tag iterator_category;
+      typedef Value value_type;
+      typedef ptrdiff_t difference_type;
+      typedef const Value* pointer;
+      typedef Value reference;
+
+      /// Default constructor (singular iterator).
+      Iterator() : myPtr( 0 ) {}
+
+      /// @return the value at the current position.
+      Value operator*() const
+      {
+        return ImageContainerByMappedFile<Domain, Value>::load( myPtr );
+      }
+
+      bool operator==( const Iterator & other ) const
+      {
+        return myPtr == other.myPtr;
+      }
+
+      bool operator!=( const Iterator & other ) const
+      {
+        return myPtr != other.myPtr;
+      }
+
+      Iterator & operator++()
+      {
+        myPtr += sizeof( Value );
+        return *this;
+      }
+
+      Iterator operator++( int )
+      {
+        Iterator tmp = *this;
+        myPtr += sizeof( Value );
+        return tmp;
+      }
+
+      Iterator & operator--()
+      {
+        myPtr -= sizeof( Value );
+        return *this;
+      }
+
+      Iterator operator--( int )
+      {
+        Iterator tmp = *this;
+        myPtr -= sizeof( Value );
+        return tmp;
+      }
+
+    private:
+      Iterator( unsigned char * aPtr ) : myPtr( aPtr ) {}
+
+      /// Address of the current value in the mapping.
+      unsigned char * myPtr;
+    };
+
+    /// The values are read through the mapping in both cases.
+    typedef Iterator ConstIterator;
+
+    /**
+     * Specific SpanIterator on ImageContainerByMappedFile: it moves
+     * along one dimension of the domain, directly in the mapping.
+     */
+    class SpanIterator
+    {
+      friend class ImageContainerByMappedFile<Domain, Value>;
+
+    public:
+      typedef std::bidirectional_iterator_tag iterator_category;
+      typedef Value value_type;
+      typedef ptrdiff_t difference_type;
+      typedef const Value* pointer;
+      typedef Value reference;
+
+      /// @return the value at the current position.
+      Value operator*() const
+      {
+        return ImageContainerByMappedFile<Domain, Value>::load( myPtr );
+      }
+
+      /**
+       * Set a value at a SpanIterator position.
+       * @param aVal the value to set.
+       */
+      void setValue( const Value aVal )
+      {
+        ImageContainerByMappedFile<Domain, Value>::store( myPtr, aVal );
+      }
+
+      bool operator==( const SpanIterator & other ) const
+      {
+        return myPtr == other.myPtr;
+      }
+
+      bool operator!=( const SpanIterator & other ) const
+      {
+        return myPtr != other.myPtr;
+      }
+
+      SpanIterator & operator++()
+      {
+        myPtr += myShift;
+        return *this;
+      }
+
+      SpanIterator operator++( int )
+      {
+        SpanIterator tmp = *this;
+        myPtr += myShift;
+        return tmp;
+      }
+
+      SpanIterator & operator--()
+      {
+        myPtr -= myShift;
+        return *this;
+      }
+
+      SpanIterator operator--( int )
+      {
+        SpanIterator tmp = *this;
+        myPtr -= myShift;
+        return tmp;
+      }
+
+    private:
+      SpanIterator( unsigned char * aPtr, std::ptrdiff_t aShift )
+        : myPtr( aPtr ), myShift( aShift ) {}
+
+      /// Address of the current value in the mapping.
+      unsigned char * myPtr;
+      /// Number of bytes between two consecutive values of the span.
+      std::ptrdiff_t myShift;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Maps the payload of a file.
+     *
+     * @param filename the file name.
+     * @param anOffset the position (in bytes) of the first value in
+     * the file (e.g. the size of its header).
+     * @param aPointA a point of the domain.
+     * @param aPointB another point of the domain.
+     *
+     * @throw IOException if the file cannot be mapped or is too small
+     * for the domain.
+     */
+    ImageContainerByMappedFile( const std::string & filename,
+                                std::size_t anOffset,
+                                const Point & aPointA,
+                                const Point & aPointB )
+      throw( DGtal::IOException );
+
+    /**
+     * Destructor. The file is unmapped with the last copy.
+     */
+    ~ImageContainerByMappedFile();
+
+    // ----------------------- Image services ------------------------------
+  public:
+
+    /**
+     * Get the value of an image at a given position.
+     *
+     * @param aPoint position in the image.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Get the value of an image at a given position given by an
+     * Iterator.
+     *
+     * @param it position in the image.
+     * @return the value at it.
+     */
+    Value operator()( const Iterator & it ) const
+    {
+      return *it;
+    }
+
+    /**
+     * Get the value of an image at a given SpanIterator position.
+     *
+     * @param it position in the image.
+     * @return the value at it.
+     */
+    Value operator()( const SpanIterator & it ) const
+    {
+      return *it;
+    }
+
+    /**
+     * Set a value on an Image at aPoint (the file is not modified).
+     *
+     * @param aPoint location of the point to associate with aValue.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * Set a value on an Image at a position specified by an Iterator.
+     *
+     * @param it iterator on the location.
+     * @param aValue the value.
+     */
+    void setValue( const Iterator & it, const Value & aValue )
+    {
+      store( it.myPtr, aValue );
+    }
+
+    /**
+     * Set a value on an Image at a position specified by a SpanIterator.
+     *
+     * @param it iterator on the location.
+     * @param aValue the value.
+     */
+    void setValue( SpanIterator & it, const Value & aValue )
+    {
+      it.setValue( aValue );
+    }
+
+    /**
+     * @return an iterator on the first value (linearized order).
+     */
+    Iterator begin() const
+    {
+      return Iterator( myData );
+    }
+
+    /**
+     * @return an iterator after the last value (linearized order).
+     */
+    Iterator end() const
+    {
+      return Iterator( myData + mySize * sizeof( Value ) );
+    }
+
+    /**
+     * Create a begin() SpanIterator at a given position in a given
+     * direction.
+     *
+     * @param aPoint the starting point of the SpanIterator.
+     * @param aDimension the dimension on which the iterator iterates.
+     *
+     * @return a SpanIterator
+     */
+    SpanIterator spanBegin( const Point & aPoint, const Dimension aDimension ) const;
+
+    /**
+     * Create an end() SpanIterator at a given position in a given
+     * direction.
+     *
+     * @param aPoint a point belonging to the current image dimension
+     * (not necessarily the point used in the spanBegin() method).
+     * @param aDimension the dimension on which the iterator iterates.
+     *
+     * @return a SpanIterator
+     */
+    SpanIterator spanEnd( const Point & aPoint, const Dimension aDimension ) const;
+
+    /**
+     * Returns the extent of an Image.
+     *
+     * @return the image extent as a Vector.
+     */
+    Vector extent() const;
+
+    /**
+     * @return the image lower point.
+     */
+    Point lowerBound() const
+    {
+      return myLowerBound;
+    }
+
+    /**
+     * @return the image upper point.
+     */
+    Point upperBound() const
+    {
+      return myUpperBound;
+    }
+
+    /**
+     * @return the domain associated to the image.
+     */
+    Domain domain() const
+    {
+      return Domain( myLowerBound, myUpperBound );
+    }
+
+    /**
+     * @return the number of values of the image.
+     */
+    Size size() const
+    {
+      return mySize;
+    }
+
+    /**
+     * @return the address of the payload (the first value) in the
+     * mapping.
+     */
+    const unsigned char * data() const
+    {
+      return myData;
+    }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * Decodes the little-endian value stored at a given address.
+     * @param aPtr the address of the value.
+     * @return the value.
+     */
+    static Value load( const unsigned char * aPtr );
+
+    /**
+     * Encodes a value in little-endian order at a given address.
+     * @param aPtr the address of the value.
+     * @param aValue the value.
+     */
+    static void store( unsigned char * aPtr, const Value & aValue );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * A mapped region of a file, unmapped at destruction.
+     */
+    struct MappedRegion
+    {
+      MappedRegion( void * anAddress, std::size_t aLength )
+        : address( anAddress ), length( aLength ) {}
+      ~MappedRegion();
+      /// Start of the region (page aligned).
+      void * address;
+      /// Length of the region in bytes.
+      std::size_t length;
+    };
+
+    /// The mapping, shared by the copies of the image.
+    CountedPtr<MappedRegion> myRegion;
+    /// Address of the first value.
+    unsigned char * myData;
+    /// Lower bound of the domain.
+    Point myLowerBound;
+    /// Upper bound of the domain.
+    Point myUpperBound;
+    /// Number of values.
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    ImageContainerByMappedFile();
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the index of @a aPoint in the linearized order.
+     */
+    Size linearized( const Point & aPoint ) const;
+
+  }; // end of class ImageContainerByMappedFile
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByMappedFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByMappedFile' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerByMappedFile<TDomain, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByMappedFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByMappedFile_h
+
+#undef ImageContainerByMappedFile_RECURSES
+#endif // else defined(ImageContainerByMappedFile_RECURSES)
@@ -529,6 +529,92 @@ namespace DGtal
     return out;
   }
 
+  namespace detail
+  {
+    /**
+     * @return a pointer to the raw data of an image, or NULL if the
+     * image container does not store its values in a contiguous
+     * linearized buffer.
+     */
+    template <typename Image>
+    inline
+    const typename Image::Value * rawImageData( const Image & /*aImage*/ )
+    {
+      return NULL;
+    }
+
+    /**
+     * @return a pointer to the raw data of an image, or NULL if the
+     * image container does not store its values in a contiguous
+     * linearized buffer.
+     */
+    template <typename Image>
+    inline
+    typename Image::Value * rawImageData( Image & /*aImage*/ )
+    {
+      return NULL;
+    }
+
+    /**
+     * @return a pointer to the raw data of an
+     * ImageContainerBySTLVector (values are stored in linearized
+     * order, first dimension first).
+     */
+    template <typename Domain, typename Value>
+    inline
+    const Value * rawImageData( const ImageContainerBySTLVector<Domain, Value> & aImage )
+    {
+      return &aImage[ 0 ];
+    }
+
+    /**
+     * @return a pointer to the raw data of an
+     * ImageContainerBySTLVector (values are stored in linearized
+     * order, first dimension first).
+     */
+    template <typename Domain, typename Value>
+    inline
+    Value * rawImageData( ImageContainerBySTLVector<Domain, Value> & aImage )
+    {
+      return &aImage[ 0 ];
+    }
+
+    /**
+     * @param lower the lower bound of a linearized buffer (see
+     * rawImageData).
+     * @param upper the upper bound of the buffer.
+     * @return the strides of the buffer (stride of dimension k at
+     * index k).
+     */
+    template <typename Size, typename Point>
+    inline
+    std::vector<Size> rawImageStrides( const Point & lower, const Point & upper )
+    {
+      std::vector<Size> strides( Point::dimension );
+      strides[ 0 ] = 1;
+      for ( typename Point::Dimension k = 1; k < Point::dimension; ++k )
+        strides[ k ] = strides[ k - 1 ] * ( upper[ k - 1 ] - lower[ k - 1 ] + 1 );
+      return strides;
+    }
+
+    /**
+     * @param aPoint a point of a linearized buffer.
+     * @param lower the lower bound of the buffer.
+     * @param strides the strides given by rawImageStrides.
+     * @return the linearized index of @a aPoint.
+     */
+    template <typename Size, typename Point>
+    inline
+    Size rawImageIndex( const Point & aPoint, const Point & lower,
+                        const std::vector<Size> & strides )
+    {
+      Size index = 0;
+      for ( typename Point::Dimension k = 0; k < Point::dimension; ++k )
+        index += strides[ k ] * ( aPoint[ k ] - lower[ k ] );
+      return index;
+    }
+  }
+
 } // namespace DGtal
 
 
@@ -66,6 +66,14 @@ namespace DGtal
    * Main methods in this class are keyFromCoordinates to generate a
    * key and CoordinatesFromKey to generate a point from a code.
    *
+   * In dimension 2 and 3, when the hash key fits in 64 bits, the
+   * (de)interleaving is done with bit-spreading magic constants
+   * (or with the BMI2 pdep/pext instructions when the code is
+   * compiled with BMI2 support, i.e. when __BMI2__ is defined)
+   * instead of the bit-per-bit loops. The generic loops are still
+   * available through interleaveBitsGeneric and
+   * coordinatesFromKeyGeneric.
+   *
    * @tparam THashKey type to store the morton code (should have
    * enough capacity to store the interleaved binary word).
    * @tparam TPoint type of points. 
@@ -97,6 +105,14 @@ namespace DGtal
      */ 
     void interleaveBits(const Point  & aPoint, HashKey & output) const;
 
+    /**
+     * Interleave the bits of the nbIn inputs, bit per bit, whatever
+     * the dimension (reference implementation of interleaveBits).
+     * @param input an array of the nbIn values to mix in.
+     * @param output The result
+     */ 
+    void interleaveBitsGeneric(const Point  & aPoint, HashKey & output) const;
+
 
     /**
      * Returns the key corresponding to the coordinates passed in the parameters.
@@ -117,6 +133,16 @@ namespace DGtal
      */
     void coordinatesFromKey(const HashKey key, Point & coordinates) const;
 
+    /**
+     * Computes the coordinates correspponding to a key, bit per bit,
+     * whatever the dimension (reference implementation of
+     * coordinatesFromKey).
+     *
+     * @param key The key.
+     * @param coordinates Will contain the resulting coordinates.
+     */
+    void coordinatesFromKeyGeneric(const HashKey key, Point & coordinates) const;
+
     /**
      * Returns the parent key of a key passed in parameter.
      *
@@ -151,6 +177,51 @@ namespace DGtal
     //boost::array< HashKey,LOG2<sizeof(HashKey)*8>::VALUE> myDilateMasks;
     //boost::array< HashKey,LOG2<sizeof(HashKey)*8>::VALUE> myContractMasks;
   };
+
+  namespace detail
+  {
+    /**
+     * Dimension-specialized Morton (de)interleaving. The generic
+     * version is not available (available == false) and Morton falls
+     * back to its bit per bit loops. The 2D and 3D specializations
+     * are only used for hash keys of at most 64 bits.
+     *
+     * @tparam dim the dimension.
+     * @tparam fitsIn64Bits true if the hash key has at most 64 bits.
+     */
+    template <Dimension dim, bool fitsIn64Bits>
+    struct MortonCodec
+    {
+      static const bool available = false;
+      static inline DGtal::uint64_t encode( const DGtal::uint64_t*, unsigned int )
+      { return 0; }
+      static inline void decode( DGtal::uint64_t, unsigned int, DGtal::uint64_t* )
+      { }
+    };
+
+    /// 2D specialization (at most 32 bits per coordinate).
+    template <>
+    struct MortonCodec<2, true>
+    {
+      static const bool available = true;
+      static inline DGtal::uint64_t encode( const DGtal::uint64_t* input,
+                                            unsigned int coordSize );
+      static inline void decode( DGtal::uint64_t key, unsigned int coordSize,
+                                 DGtal::uint64_t* output );
+    };
+
+    /// 3D specialization (at most 21 bits per coordinate).
+    template <>
+    struct MortonCodec<3, true>
+    {
+      static const bool available = true;
+      static inline DGtal::uint64_t encode( const DGtal::uint64_t* input,
+                                            unsigned int coordSize );
+      static inline void decode( DGtal::uint64_t key, unsigned int coordSize,
+                                 DGtal::uint64_t* output );
+    };
+  } // namespace detail
+
 } // namespace DGtal
 
 
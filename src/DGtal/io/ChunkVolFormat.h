@@ -0,0 +1,212 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChunkVolFormat.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/25
+ *
+ * Header file for module ChunkVolFormat.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ChunkVolFormat_RECURSES)
+#error Recursive header files inclusion detected in ChunkVolFormat.h
+#else // defined(ChunkVolFormat_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChunkVolFormat_RECURSES
+
+#if !defined ChunkVolFormat_h
+/** Prevents repeated inclusion of headers. */
+#define ChunkVolFormat_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstdio>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct ChunkVolFormat
+  /**
+   * Description of struct 'ChunkVolFormat' <p>
+   * \brief Aim: services shared by ChunkVolReader and ChunkVolWriter
+   * to read and write the "chunked volume" format.
+   *
+   * A chunked volume is a 3D image cut into bricks of fixed size
+   * (the bricks of the last row, column or plane may be smaller),
+   * each brick being compressed independently. A file is made of:
+   * - a text header, as in the Vol format:
+   * @code
+   * Chunk-Vol: 1
+   * X: 512
+   * Y: 512
+   * Z: 300
+   * Brick-X: 32
+   * Brick-Y: 32
+   * Brick-Z: 32
+   * Value-Size: 4
+   * Codec: RLE
+   * .
+   * @endcode
+   * - the index: for each brick (in scan order, x first), the
+   *   position of its data in the file and its length in bytes (two
+   *   64 bits little endian integers);
+   * - the compressed bricks.
+   *
+   * The values of a brick are taken in scan order and coded as runs
+   * of equal values: the length of the run (7 bits per byte, least
+   * significant group first, the high bit telling that a byte
+   * follows) then the value (Value-Size bytes, little endian). This
+   * is cheap to code and decode and very efficient on label images.
+   *
+   * @see ChunkVolReader, ChunkVolWriter
+   */
+  struct ChunkVolFormat
+  {
+    /**
+     * Header of a chunked volume file.
+     */
+    struct Header
+    {
+      /// Extent of the volume.
+      long int size[ 3 ];
+      /// Extent of the bricks.
+      long int brickSize[ 3 ];
+      /// Number of bytes of a value.
+      unsigned int valueSize;
+      /// Position of the index in the file.
+      long int indexOffset;
+
+      /**
+       * @param k a dimension.
+       * @return the number of bricks along @a k.
+       */
+      long int nbBricks( const unsigned int k ) const;
+
+      /**
+       * @return the number of bricks.
+       */
+      long int nbBricks() const;
+    };
+
+    /**
+     * Position and length of a compressed brick in the file.
+     */
+    struct Entry
+    {
+      DGtal::uint64_t offset;
+      DGtal::uint64_t length;
+    };
+
+    /**
+     * Writes the text header and sets its index offset.
+     * @param fout the file, at its beginning.
+     * @param header (modified) the header.
+     */
+    static void writeHeader( FILE * fout, Header & header )
+      throw( DGtal::IOException );
+
+    /**
+     * Reads and checks the text header.
+     * @param fin the file, at its beginning (after the call, at the
+     * index).
+     * @param header (modified) the header.
+     */
+    static void readHeader( FILE * fin, Header & header )
+      throw( DGtal::IOException );
+
+    /**
+     * Writes the index at its position.
+     * @param fout the file.
+     * @param header the header.
+     * @param entries the index (one entry per brick).
+     */
+    static void writeIndex( FILE * fout, const Header & header,
+                            const std::vector<Entry> & entries )
+      throw( DGtal::IOException );
+
+    /**
+     * Reads the index.
+     * @param fin the file.
+     * @param header the header.
+     * @param entries (modified) the index (one entry per brick).
+     */
+    static void readIndex( FILE * fin, const Header & header,
+                           std::vector<Entry> & entries )
+      throw( DGtal::IOException );
+
+    /**
+     * Computes the bounds of a brick.
+     * @tparam TPoint a 3D point type.
+     * @param header the header.
+     * @param i the index of the brick.
+     * @param lower (modified) the lower bound of the brick.
+     * @param upper (modified) the upper bound of the brick.
+     */
+    template <typename TPoint>
+    static void brickBounds( const Header & header, const long int i,
+                             TPoint & lower, TPoint & upper );
+
+    /**
+     * Compresses values.
+     * @param values the values.
+     * @param data (modified) the compressed data (appended).
+     */
+    template <typename TValue>
+    static void encode( const std::vector<TValue> & values,
+                        std::vector<unsigned char> & data );
+
+    /**
+     * Decompresses values.
+     * @param data the compressed data.
+     * @param length the number of bytes of @a data.
+     * @param values (modified) the values (sized to the expected
+     * number of values).
+     * @return 'false' if the data does not give the expected number
+     * of values.
+     */
+    template <typename TValue>
+    static bool decode( const unsigned char * data, const std::size_t length,
+                        std::vector<TValue> & values );
+
+  }; // end of struct ChunkVolFormat
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/ChunkVolFormat.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChunkVolFormat_h
+
+#undef ChunkVolFormat_RECURSES
+#endif // else defined(ChunkVolFormat_RECURSES)
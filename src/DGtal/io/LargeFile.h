@@ -0,0 +1,95 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file LargeFile.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/27
+ *
+ * Header file for module LargeFile.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(LargeFile_RECURSES)
+#error Recursive header files inclusion detected in LargeFile.h
+#else // defined(LargeFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define LargeFile_RECURSES
+
+#if !defined LargeFile_h
+/** Prevents repeated inclusion of headers. */
+#define LargeFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cstdio>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct LargeFile
+  /**
+   * Description of struct 'LargeFile' <p>
+   * \brief Aim: positions a C stream with 64 bits offsets, so that
+   * files over 2GB can be read and written where fseek and ftell
+   * take a 32 bits long int (32 bits builds, Windows).
+   *
+   * On Windows, _fseeki64 and _ftelli64 are used; otherwise fseeko
+   * and ftello. If off_t has only 32 bits (32 bits POSIX build
+   * without -D_FILE_OFFSET_BITS=64), the offsets that do not fit are
+   * reported as errors instead of being truncated.
+   */
+  struct LargeFile
+  {
+    /**
+     * Moves the position of a stream.
+     *
+     * @param file an opened stream.
+     * @param offset the new position, from the beginning of the file.
+     * @return 0 on success, non-zero otherwise.
+     */
+    static int seek( FILE * file, const DGtal::int64_t offset );
+
+    /**
+     * @param file an opened stream.
+     * @return the position of the stream, or -1 on error.
+     */
+    static DGtal::int64_t tell( FILE * file );
+
+  }; // end of struct LargeFile
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/LargeFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined LargeFile_h
+
+#undef LargeFile_RECURSES
+#endif // else defined(LargeFile_RECURSES)
@@ -0,0 +1,357 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SlabProcessing.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/23
+ *
+ * Header file for module SlabProcessing.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SlabProcessing_RECURSES)
+#error Recursive header files inclusion detected in SlabProcessing.h
+#else // defined(SlabProcessing_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SlabProcessing_RECURSES
+
+#if !defined SlabProcessing_h
+/** Prevents repeated inclusion of headers. */
+#define SlabProcessing_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <map>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/imagesSetsUtils/SimpleForegroundPredicate.h"
+#include "DGtal/geometry/nd/volumetric/DistanceTransformation.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct SlabProcessing
+  /**
+   * Description of struct 'SlabProcessing' <p>
+   * \brief Aim: runs an operator on a volume slab by slab, reading
+   * the slabs with a SlabReader and writing the results with a
+   * SlabWriter, so that only one slab (and its result) is in memory
+   * at a time.
+   *
+   * An operator (see SlabThreshold, SlabDistanceTransformation and
+   * SlabComponentLabelling) provides:
+   * - a type OutputImage (with a (Point,Point) constructor);
+   * - overlap(): the number of planes it needs on each side of the
+   *   cores (the reader overlap should not be lower);
+   * - needsAnalysis(): if true, analyze(slab, core) is first called
+   *   on each slab, in increasing z order, before any output;
+   * - operator()(slab, core, output): computes the values of the
+   *   points of the core in @a output (defined on the core).
+   *
+   * @code
+   * SlabReader<Image> reader( 32, 1 );
+   * reader.openVol( "in.vol" );
+   * SlabComponentLabelling<Image> labelling( 3 );
+   * SlabWriter<SlabComponentLabelling<Image>::OutputImage,
+   *            GrayscaleColorMap<DGtal::uint32_t> > writer( 0, 255 );
+   * writer.openVol( "labels.vol", reader.extent() );
+   * SlabProcessing::process( reader, labelling, writer );
+   * @endcode
+   *
+   * @see testSlabProcessing.cpp
+   */
+  struct SlabProcessing
+  {
+    /**
+     * Processes all the slabs of a reader (from the first one) and
+     * writes the results.
+     *
+     * @param reader an opened SlabReader.
+     * @param op the operator.
+     * @param writer an opened SlabWriter (its file is completed once
+     * all the slabs have been written).
+     * @return the number of processed slabs (0 if the reader overlap
+     * is too small for the operator).
+     */
+    template <typename TReader, typename TOperator, typename TWriter>
+    static unsigned int process( TReader & reader, TOperator & op,
+                                 TWriter & writer );
+  };
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SlabThreshold
+  /**
+   * Description of template class 'SlabThreshold' <p>
+   * \brief Aim: slab operator which thresholds the values with a
+   * SimpleForegroundPredicate: the points with a value in
+   * ]minVal,maxVal] get 1, the other ones 0.
+   *
+   * @tparam TImage the image type of the slabs.
+   */
+  template <typename TImage>
+  class SlabThreshold
+  {
+  public:
+    typedef TImage Image;
+    typedef typename Image::Value Value;
+    typedef typename Image::Domain Domain;
+    typedef typename Domain::Integer Integer;
+    typedef ImageContainerBySTLVector<Domain, unsigned char> OutputImage;
+
+    /**
+     * Constructor.
+     * @param minVal the minimum value (excluded).
+     * @param maxVal the maximum value (included).
+     */
+    SlabThreshold( const Value & minVal, const Value & maxVal );
+
+    /// @return 0, the points are processed independently.
+    Integer overlap() const;
+
+    /// @return false.
+    bool needsAnalysis() const;
+
+    /// Does nothing.
+    void analyze( const Image & aSlab, const Domain & aCore );
+
+    /**
+     * Thresholds the core of a slab.
+     * @param aSlab the slab.
+     * @param aCore the core of the slab.
+     * @param output (modified) the image of the core.
+     */
+    void operator()( const Image & aSlab, const Domain & aCore,
+                     OutputImage & output ) const;
+
+  private:
+    /// The minimum value (excluded).
+    Value myMin;
+    /// The maximum value (included).
+    Value myMax;
+  }; // end of class SlabThreshold
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SlabDistanceTransformation
+  /**
+   * Description of template class 'SlabDistanceTransformation' <p>
+   * \brief Aim: slab operator which computes the steps of the
+   * separable DistanceTransformation along x and y (see
+   * DistanceTransformation::computePartial): each foreground point
+   * (value different from zero) gets the @a p power of its distance
+   * to the closest background point of its z plane.
+   *
+   * As the planes are independent, the result is exactly the one of
+   * computePartial( image, 2 ) on the whole volume, except that the
+   * points without background point in their plane get the @a
+   * infinity value given to the constructor (the value of
+   * DistanceTransformation depends on the extent of the image). The
+   * last step (along z) needs whole columns and is not done here.
+   *
+   * @tparam TImage the image type of the slabs.
+   * @tparam p the exponent of the Lp metric.
+   * @tparam IntegerLong the type of the output values.
+   */
+  template <typename TImage, DGtal::uint32_t p,
+            typename IntegerLong = DGtal::int64_t>
+  class SlabDistanceTransformation
+  {
+  public:
+    typedef TImage Image;
+    typedef typename Image::Domain Domain;
+    typedef typename Domain::Integer Integer;
+    typedef DistanceTransformation<Image, p, IntegerLong> DT;
+    typedef typename DT::OutputImage OutputImage;
+
+    BOOST_STATIC_ASSERT(Domain::dimension == 3);
+
+    /**
+     * Constructor.
+     * @param anInfinity the value given to the points without
+     * background point in their plane.
+     */
+    SlabDistanceTransformation( const IntegerLong anInfinity );
+
+    /// @return 0, the planes are processed independently.
+    Integer overlap() const;
+
+    /// @return false.
+    bool needsAnalysis() const;
+
+    /// Does nothing.
+    void analyze( const Image & aSlab, const Domain & aCore );
+
+    /**
+     * Computes the steps along x and y on the core of a slab.
+     * @param aSlab the slab.
+     * @param aCore the core of the slab.
+     * @param output (modified) the image of the core.
+     */
+    void operator()( const Image & aSlab, const Domain & aCore,
+                     OutputImage & output ) const;
+
+  private:
+    /// The value of the points without background point.
+    IntegerLong myInfinity;
+  }; // end of class SlabDistanceTransformation
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SlabComponentLabelling
+  /**
+   * Description of template class 'SlabComponentLabelling' <p>
+   * \brief Aim: slab operator which labels the connected components
+   * of a volume (maximal connected sets of points with the same
+   * value, see ConnectedComponentLabelling). The labels are the same
+   * as the ones computed by ConnectedComponentLabelling on the whole
+   * volume.
+   *
+   * It needs an overlap of one plane and two passes. During the
+   * analysis, the core of each slab is labelled with
+   * ConnectedComponentLabelling, its components get provisional
+   * labels following the ones of the previous slabs, and the
+   * components touching the last plane of the previous core are
+   * merged in a union-find forest on the provisional labels (the
+   * root of a set is its smallest label). The provisional labels
+   * being ordered as the first points of the components, numbering
+   * the roots in increasing order gives the scan order labels. The
+   * second pass labels each core again and outputs the final
+   * labels.
+   *
+   * Besides one slab, the memory holds one plane of labels and one
+   * label per provisional component.
+   *
+   * @tparam TImage the image type of the slabs.
+   */
+  template <typename TImage>
+  class SlabComponentLabelling
+  {
+  public:
+    typedef TImage Image;
+    typedef typename Image::Domain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Dimension Dimension;
+    typedef ConnectedComponentLabelling<Image> CCL;
+    typedef typename CCL::Label Label;
+    typedef ImageContainerBySTLVector<Domain, Label> OutputImage;
+
+    BOOST_STATIC_ASSERT(Domain::dimension == 3);
+
+    /**
+     * Constructor.
+     * @param maxNorm1 the maximal l1 norm of the displacement between
+     * two adjacent points (1, 2 or 3 for the 6-, 18- and
+     * 26-connectivities).
+     */
+    SlabComponentLabelling( const Dimension maxNorm1 = 1 );
+
+    /// @return 1.
+    Integer overlap() const;
+
+    /// @return true.
+    bool needsAnalysis() const;
+
+    /**
+     * Labels the core of a slab and merges its components with the
+     * ones of the previous core. The slabs should be given in
+     * increasing z order, from the first one.
+     * @param aSlab the slab (with at least one plane before the core).
+     * @param aCore the core of the slab.
+     */
+    void analyze( const Image & aSlab, const Domain & aCore );
+
+    /**
+     * Outputs the final labels of the core of an analyzed slab.
+     * @param aSlab the slab.
+     * @param aCore the core of the slab.
+     * @param output (modified) the image of the core.
+     */
+    void operator()( const Image & aSlab, const Domain & aCore,
+                     OutputImage & output );
+
+    /**
+     * @return the number of components of the volume (once all the
+     * slabs have been analyzed).
+     */
+    Label nbComponents();
+
+  private:
+
+    /**
+     * Labels the core of a slab with ConnectedComponentLabelling.
+     * @param nbLabels (modified) the number of components of the core.
+     */
+    typename CCL::LabelImage labelCore( const Image & aSlab,
+                                        const Domain & aCore,
+                                        Label & nbLabels );
+
+    /**
+     * @return the root of the set of @a i (with path halving).
+     */
+    Label find( Label i );
+
+    /**
+     * Numbers the roots of the union-find forest (once).
+     */
+    void resolve();
+
+  private:
+    /// Maximal l1 norm of the displacements to the neighbours.
+    Dimension myMaxNorm1;
+    /// Union-find forest on the provisional labels.
+    std::vector<Label> myParents;
+    /// Final label of each provisional label.
+    std::vector<Label> myFinalLabels;
+    /// First provisional label of each core (key: first plane).
+    std::map<Integer, Label> myBases;
+    /// Provisional labels of the last plane of the previous core.
+    std::vector<Label> myLastPlane;
+    /// The last plane of the previous core.
+    Integer myLastZ;
+    /// True once the final labels are known.
+    bool myResolved;
+    /// Number of components.
+    Label myNbComponents;
+  }; // end of class SlabComponentLabelling
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/SlabProcessing.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SlabProcessing_h
+
+#undef SlabProcessing_RECURSES
+#endif // else defined(SlabProcessing_RECURSES)
@@ -0,0 +1,139 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChunkVolReader.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/25
+ *
+ * Header file for module ChunkVolReader.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ChunkVolReader_RECURSES)
+#error Recursive header files inclusion detected in ChunkVolReader.h
+#else // defined(ChunkVolReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChunkVolReader_RECURSES
+
+#if !defined ChunkVolReader_h
+/** Prevents repeated inclusion of headers. */
+#define ChunkVolReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <cstdio>
+#include <vector>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/ChunkVolFormat.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ChunkVolReader
+  /**
+   * Description of template class 'ChunkVolReader' <p>
+   * \brief Aim: implements methods to read a "chunked volume" file
+   * (see ChunkVolFormat), the whole volume or only a part of it.
+   *
+   * Only the bricks intersecting the requested domain are read and
+   * decompressed. The values are read as they were written (no
+   * colormap), so the value type of the image should have the size
+   * of the values of the file.
+   *
+   * Example usage:
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> Image;
+   * Image labels = ChunkVolReader<Image>::importChunkVol( "labels.cvol" );
+   * Image part = ChunkVolReader<Image>::importChunkVol
+   *   ( "labels.cvol", Z3i::Domain( Z3i::Point( 10, 10, 10 ), Z3i::Point( 40, 40, 40 ) ) );
+   * @endcode
+   *
+   * @tparam TImageContainer the image container to use (3D).
+   *
+   * @see ChunkVolWriter
+   * @see testChunkVol.cpp
+   */
+  template <typename TImageContainer>
+  struct ChunkVolReader
+  {
+    // ----------------------- Standard services ------------------------------
+
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Value Value;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename Domain::Point Point;
+
+    BOOST_STATIC_ASSERT(ImageContainer::Domain::dimension == 3);
+
+    /** 
+     * Main method to import a chunked volume into an instance of the 
+     * template parameter ImageContainer.
+     * 
+     * @param filename the file name to import.
+     * @return an instance of the ImageContainer.
+     */
+    static ImageContainer importChunkVol(const std::string & filename) 
+      throw(DGtal::IOException);
+
+    /** 
+     * Imports the part of a chunked volume inside a domain.
+     * 
+     * @param filename the file name to import.
+     * @param aDomain the requested domain (it is clipped to the
+     * domain of the volume, which should intersect it).
+     * @return an instance of the ImageContainer defined on the
+     * clipped domain.
+     */
+    static ImageContainer importChunkVol(const std::string & filename,
+           const Domain & aDomain) 
+      throw(DGtal::IOException);
+
+    /** 
+     * Reads the header of a chunked volume.
+     * 
+     * @param filename the file name.
+     * @return the domain of the volume.
+     */
+    static Domain domain(const std::string & filename) 
+      throw(DGtal::IOException);
+    
+  }; // end of class ChunkVolReader
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/ChunkVolReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChunkVolReader_h
+
+#undef ChunkVolReader_RECURSES
+#endif // else defined(ChunkVolReader_RECURSES)
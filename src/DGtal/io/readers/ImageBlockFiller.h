@@ -0,0 +1,197 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageBlockFiller.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/19
+ *
+ * Header file for module ImageBlockFiller.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageBlockFiller_RECURSES)
+#error Recursive header files inclusion detected in ImageBlockFiller.h
+#else // defined(ImageBlockFiller_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageBlockFiller_RECURSES
+
+#if !defined ImageBlockFiller_h
+/** Prevents repeated inclusion of headers. */
+#define ImageBlockFiller_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageBlockFiller
+  /**
+   * Description of template class 'ImageBlockFiller' <p>
+   * \brief Aim: fills an image with consecutive blocks of values
+   * given in the scanning order of its domain (first coordinate
+   * first), as read from a file by the image readers.
+   *
+   * The generic version sets each value at the current point of a
+   * domain iterator. The specialization for
+   * ImageContainerBySTLVector copies the blocks straight into the
+   * vector, whose linearized order is the scanning order.
+   *
+   * @code
+   * Image image( lower, upper );
+   * ImageBlockFiller<Image> filler( image, Domain( lower, upper ) );
+   * std::vector<unsigned char> slice( sx * sy );
+   * for ( int z = 0; z < sz; ++z )
+   *   {
+   *     fread( &slice[ 0 ], 1, slice.size(), fin );
+   *     filler.fill( &slice[ 0 ], slice.size() );
+   *   }
+   * @endcode
+   *
+   * @tparam TImageContainer the image container to fill.
+   *
+   * @see VolReader, LongvolReader, RawReader
+   */
+  template <typename TImageContainer>
+  class ImageBlockFiller
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+    typedef typename ImageContainer::Value Value;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param anImage the image to fill (it should remain valid).
+     * @param aDomain the domain of the values to fill.
+     */
+    ImageBlockFiller( ImageContainer & anImage, const Domain & aDomain );
+
+    /**
+     * Sets the next @a n values of the image.
+     * @tparam TWord a type convertible to Value.
+     * @param buffer the values.
+     * @param n the number of values (no more than the remaining ones).
+     */
+    template <typename TWord>
+    void fill( const TWord * buffer, std::size_t n );
+
+    /**
+     * @return the number of values filled so far.
+     */
+    std::size_t count() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The image.
+    ImageContainer & myImage;
+    /// The filled domain.
+    Domain myDomain;
+    /// The next point to fill.
+    typename Domain::ConstIterator myIt;
+    /// The number of filled values.
+    std::size_t myCount;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+    ImageBlockFiller();
+    ImageBlockFiller( const ImageBlockFiller & other );
+    ImageBlockFiller & operator=( const ImageBlockFiller & other );
+  }; // end of class ImageBlockFiller
+
+
+  /**
+   * Specialization of ImageBlockFiller for ImageContainerBySTLVector:
+   * the values are copied into the vector.
+   */
+  template <typename TDomain, typename TValue>
+  class ImageBlockFiller< ImageContainerBySTLVector<TDomain, TValue> >
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef ImageContainerBySTLVector<TDomain, TValue> ImageContainer;
+    typedef TDomain Domain;
+    typedef TValue Value;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param anImage the image to fill (it should remain valid).
+     * @param aDomain the domain of the values to fill (the domain of
+     * the image).
+     */
+    ImageBlockFiller( ImageContainer & anImage, const Domain & aDomain );
+
+    /**
+     * Copies the next @a n values into the image.
+     * @tparam TWord a type convertible to Value.
+     * @param buffer the values.
+     * @param n the number of values (no more than the remaining ones).
+     */
+    template <typename TWord>
+    void fill( const TWord * buffer, std::size_t n );
+
+    /**
+     * @return the number of values filled so far.
+     */
+    std::size_t count() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The image.
+    ImageContainer & myImage;
+    /// The number of filled values.
+    std::size_t myCount;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+    ImageBlockFiller();
+    ImageBlockFiller( const ImageBlockFiller & other );
+    ImageBlockFiller & operator=( const ImageBlockFiller & other );
+  }; // end of class ImageBlockFiller
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/ImageBlockFiller.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageBlockFiller_h
+
+#undef ImageBlockFiller_RECURSES
+#endif // else defined(ImageBlockFiller_RECURSES)
@@ -43,9 +43,11 @@
 #include <iostream>
 #include <string>
 #include <cstdio>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include <boost/static_assert.hpp>
 #include "DGtal/helpers/StdDefs.h"
+#include "DGtal/io/readers/ImageBlockFiller.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -101,27 +103,41 @@ namespace DGtal
      * @return an instance of the ImageContainer.
      */
     static ImageContainer importLongvol(const std::string & filename) throw(DGtal::IOException);
+
+
+    /** 
+     * Maps the Longvol payload of a file into an instance of the
+     * template parameter ImageContainer, which must be an
+     * ImageContainerByMappedFile with DGtal::uint64_t values. The file is
+     * mapped in memory: no value is read before it is accessed.
+     * 
+     * @param filename the file name to map.
+     * @return an instance of the ImageContainer.
+     */
+    static ImageContainer mapLongvol(const std::string & filename) throw(DGtal::IOException);
     
    
     
   private:
 
     /** 
-     * Generic read word (binary mode) in little-endian mode.
+     * Generic decoding of words (binary mode) in little-endian mode.
      * 
-     * @param fin input FILE.
-     * @param value value to write.
-     * 
-     * @return modified stream.
+     * @param bytes the bytes read from the file.
+     * @param n the number of words.
+     * @param words (modified) the n decoded words.
      */
     template <typename Word>
     static
-    FILE* read_word( FILE* fin, Word& aValue )
+    void read_words( const unsigned char* bytes, std::size_t n, Word* words )
     {
-      aValue = 0;
-      for (unsigned size = 0; size < sizeof( Word ); ++size)
-  aValue |= getc(fin) << (8 * size);
-      return fin;
+      for ( std::size_t i = 0; i < n; ++i, bytes += sizeof( Word ) )
+        {
+          Word aValue = 0;
+          for (unsigned size = 0; size < sizeof( Word ); ++size)
+            aValue |= static_cast<Word>( bytes[ size ] ) << (8 * size);
+          words[ i ] = aValue;
+        }
     }
 
     typedef unsigned char voxel;
@@ -161,6 +177,18 @@ namespace DGtal
     };
 
 
+    /** 
+     * Reads and checks the header of a Longvol file.
+     * 
+     * @param fin the file, at its beginning (after the call, at the
+     * first voxel).
+     * @param sx (modified) the size of the volume along x.
+     * @param sy (modified) the size of the volume along y.
+     * @param sz (modified) the size of the volume along z.
+     */
+    static void readHeader( FILE * fin, int & sx, int & sy, int & sz )
+      throw( DGtal::IOException );
+
     //! Returns NULL if this field is not found
     static const char *getHeaderValue( const char *type, const HeaderField * header );
 
@@ -41,7 +41,11 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <cstdio>
+#include <string>
+#include <vector>
 #include "DGtal/base/Common.h"
+#include "DGtal/io/readers/ImageBlockFiller.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -51,12 +55,19 @@ namespace DGtal
 // class PNMReader
 /**
  * Description of class 'PNMReader' <p>
- * \brief Aim: Import a 2D or 3D using the Netpbm formats (ASCII mode).
- * - PPM: RGB 
- *  - PGM: grayscale
- *  - PPM3D: 3D variant of PPM
- *  - PGM3D: 3D variant of PGM
+ * \brief Aim: Import a 2D or 3D using the Netpbm formats (ASCII and
+ * binary modes).
+ * - PPM: RGB (P3 and P6)
+ *  - PGM: grayscale (P2 and P5)
+ *  - PGM3D: 3D variant of PGM (P2-3D and P3d)
  * 
+ * The samples may be 8 or 16 bits (maxval greater than 255, two
+ * bytes per sample, most significant byte first). Binary payloads are
+ * read with a single block read and ASCII payloads are parsed by
+ * hand, then the rows are copied into the image (see
+ * ImageBlockFiller). As the first row of a file is the top of the
+ * picture, it is stored at the highest y coordinate.
+ *
  *
  *  Simple example: (extract from test file testPNMReader.cpp)
  * 
@@ -96,7 +107,7 @@ namespace DGtal
     BOOST_STATIC_ASSERT( (ImageContainer::Domain::dimension == 2) || (ImageContainer::Domain::dimension == 3));
 
     /** 
-     * Main method to import a Pgm (8bits) into an instance of the 
+     * Main method to import a Pgm (8 or 16 bits) into an instance of the 
      * template parameter ImageContainer.
      * 
      * @param filename the file name to import.
@@ -106,15 +117,79 @@ namespace DGtal
 
 
     /** 
-     * Main method to import a Pgm3D (8bits) into an instance of the 
+     * Main method to import a Pgm3D (8 or 16 bits) into an instance of the 
      * template parameter ImageContainer.
      * 
      * @param filename the file name to import.
      * @return an instance of the ImageContainer.
      */
     static ImageContainer importPGM3D(const std::string & aFilename) throw(DGtal::IOException);
+
+    /** 
+     * Main method to import a Ppm (8 or 16 bits per channel) into an
+     * instance of the template parameter ImageContainer. Each color
+     * is stored as 0xRRGGBB (16 bits channels are scaled to 8 bits),
+     * so the image values should have at least 24 bits.
+     * 
+     * @param filename the file name to import.
+     * @return an instance of the ImageContainer.
+     */
+    static ImageContainer importPPMImage(const std::string & aFilename) throw(DGtal::IOException);
     
     
+  private:
+
+    /** 
+     * Opens a Netpbm file and reads its header.
+     * 
+     * @param aFilename the file name.
+     * @param magic (modified) the magic number (e.g. "P5").
+     * @param sizes (modified) the sizes of the picture.
+     * @param nbSizes the number of sizes (the dimension).
+     * @param maxValue (modified) the maximal value of the samples.
+     * @return the file, positioned at the first sample.
+     */
+    static FILE * openFile( const std::string & aFilename, std::string & magic,
+          unsigned int * sizes, const unsigned int nbSizes,
+          unsigned int & maxValue ) throw(DGtal::IOException);
+
+    /** 
+     * Reads an integer of a header, skipping the whitespaces and the
+     * comments before it. The character following the integer is
+     * consumed.
+     * 
+     * @param fin the file.
+     * @param value (modified) the integer.
+     * @return false if no integer has been found.
+     */
+    static bool readHeaderValue( FILE * fin, unsigned int & value );
+
+    /** 
+     * Reads the samples of a file: one block read in binary mode, a
+     * hand-written scanner on the rest of the file in ASCII mode.
+     * 
+     * @param fin the file, positioned at the first sample.
+     * @param isASCII true if the samples are written in decimal.
+     * @param maxValue the maximal value of the samples.
+     * @param samples (modified) the samples (sized to the number of
+     * samples to read).
+     */
+    template <typename TWord>
+    static void readSamples( FILE * fin, const bool isASCII,
+           const unsigned int maxValue,
+           std::vector<TWord> & samples ) throw(DGtal::IOException);
+
+    /** 
+     * Copies the samples into an image, the first row of each plane
+     * being the one with the highest y coordinate.
+     * 
+     * @param image (modified) the image.
+     * @param samples the samples, plane by plane and row by row.
+     * @param sizes the sizes of the picture.
+     */
+    template <typename TWord>
+    static void fillImage( ImageContainer & image, const TWord * samples,
+         const unsigned int * sizes );
     
  }; // end of class  PNMReader
 
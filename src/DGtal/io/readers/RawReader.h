@@ -43,8 +43,10 @@
 #include <iostream>
 #include <string>
 #include <cstdio>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include <boost/static_assert.hpp>
+#include "DGtal/io/readers/ImageBlockFiller.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -103,6 +105,20 @@ namespace DGtal
      */
     static ImageContainer importRaw8(const std::string & filename,
              const Vector & extent) throw(DGtal::IOException);
+
+
+    /** 
+     * Maps the Raw (8bits) payload of a file into an instance of the
+     * template parameter ImageContainer, which must be an
+     * ImageContainerByMappedFile with unsigned char values. The file is
+     * mapped in memory: no value is read before it is accessed.
+     * 
+     * @param filename the file name to map.
+     * @param extent the size of the raw data set.
+     * @return an instance of the ImageContainer.
+     */
+    static ImageContainer mapRaw8(const std::string & filename,
+          const Vector & extent) throw(DGtal::IOException);
     
   }; // end of class RawReader
 
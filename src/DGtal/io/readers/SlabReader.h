@@ -0,0 +1,252 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SlabReader.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/23
+ *
+ * Header file for module SlabReader.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SlabReader_RECURSES)
+#error Recursive header files inclusion detected in SlabReader.h
+#else // defined(SlabReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SlabReader_RECURSES
+
+#if !defined SlabReader_h
+/** Prevents repeated inclusion of headers. */
+#define SlabReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <cstdio>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/LargeFile.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/ImageBlockFiller.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SlabReader
+  /**
+   * Description of template class 'SlabReader' <p>
+   * \brief Aim: reads a 3D "Vol" or "Raw" (8bits) file as a sequence
+   * of slabs along the z axis, so that volumes larger than the memory
+   * can be processed.
+   *
+   * Each slab is made of @a slabSize consecutive planes (the @e core
+   * of the slab, the last one may be thinner), extended by @a overlap
+   * planes on each side when they exist. The cores of the successive
+   * slabs partition the volume. Only one slab is in memory at a time.
+   *
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+   * SlabReader<Image> reader( 32, 1 );
+   * reader.openVol( "data.vol" );
+   * while ( reader.nextSlab() )
+   *   {
+   *     const Image & slab = reader.slab();       // core and overlap
+   *     Z3i::Domain core = reader.coreDomain();   // core only
+   *     ...
+   *   }
+   * @endcode
+   *
+   * @tparam TImageContainer the image container used for the slabs
+   * (3D, with a (Point,Point) constructor).
+   *
+   * @see SlabWriter, SlabProcessing
+   * @see testSlabProcessing.cpp
+   */
+  template <typename TImageContainer>
+  class SlabReader
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+
+    BOOST_STATIC_ASSERT(Domain::dimension == 3);
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aSlabSize the number of planes of the core of the slabs
+     * (at least 1).
+     * @param anOverlap the number of planes added on each side of
+     * the cores.
+     */
+    SlabReader( const Integer aSlabSize, const Integer anOverlap = 0 );
+
+    /**
+     * Destructor. Closes the file.
+     */
+    ~SlabReader();
+
+    /**
+     * Opens a Vol file and reads its header.
+     *
+     * @param filename the file name.
+     */
+    void openVol( const std::string & filename ) throw( DGtal::IOException );
+
+    /**
+     * Opens a Raw (8bits) file.
+     *
+     * @param filename the file name.
+     * @param extent the size of the raw data set.
+     */
+    void openRaw8( const std::string & filename, const Vector & extent )
+      throw( DGtal::IOException );
+
+    /**
+     * Closes the file.
+     */
+    void close();
+
+    /**
+     * Goes back to the beginning of the volume: the next call to
+     * nextSlab reads the first slab.
+     */
+    void rewind();
+
+    /**
+     * Reads the next slab.
+     *
+     * @return 'false' if all the slabs have been read, 'true' otherwise.
+     */
+    bool nextSlab() throw( DGtal::IOException );
+
+    /**
+     * @return the current slab (core and overlap planes), with the
+     * coordinates of the volume.
+     */
+    const ImageContainer & slab() const;
+
+    /**
+     * @return the domain of the core of the current slab.
+     */
+    Domain coreDomain() const;
+
+    /**
+     * @return the domain of the whole volume.
+     */
+    Domain domain() const;
+
+    /**
+     * @return the extent of the whole volume.
+     */
+    Vector extent() const;
+
+    /**
+     * @return the number of planes of the cores.
+     */
+    Integer slabSize() const;
+
+    /**
+     * @return the number of planes added on each side of the cores.
+     */
+    Integer overlap() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The opened file (or NULL).
+    FILE * myFile;
+    /// Position of the first voxel in the file.
+    DGtal::int64_t myOffset;
+    /// Extent of the volume.
+    Vector myExtent;
+    /// Number of planes of the cores.
+    Integer mySlabSize;
+    /// Number of planes added on each side of the cores.
+    Integer myOverlap;
+    /// First plane of the next core.
+    Integer myNextZ;
+    /// Lower bound of the current core.
+    Point myCoreLower;
+    /// Upper bound of the current core.
+    Point myCoreUpper;
+    /// The current slab (owned).
+    ImageContainer * mySlab;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    SlabReader();
+    SlabReader( const SlabReader & other );
+    SlabReader & operator= ( const SlabReader & other );
+
+  }; // end of class SlabReader
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SlabReader'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SlabReader' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer>
+  std::ostream&
+  operator<< ( std::ostream & out, const SlabReader<TImageContainer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/SlabReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SlabReader_h
+
+#undef SlabReader_RECURSES
+#endif // else defined(SlabReader_RECURSES)
@@ -43,9 +43,11 @@
 #include <iostream>
 #include <string>
 #include <cstdio>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include <boost/static_assert.hpp>
 #include "DGtal/helpers/StdDefs.h"
+#include "DGtal/io/readers/ImageBlockFiller.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -102,6 +104,30 @@ namespace DGtal
      * @return an instance of the ImageContainer.
      */
     static ImageContainer importVol(const std::string & filename) throw(DGtal::IOException);
+
+
+    /** 
+     * Maps the Vol payload of a file into an instance of the
+     * template parameter ImageContainer, which must be an
+     * ImageContainerByMappedFile with unsigned char values. The file is
+     * mapped in memory: no value is read before it is accessed.
+     * 
+     * @param filename the file name to map.
+     * @return an instance of the ImageContainer.
+     */
+    static ImageContainer mapVol(const std::string & filename) throw(DGtal::IOException);
+
+    /** 
+     * Reads and checks the header of a Vol file.
+     * 
+     * @param fin the file, at its beginning (after the call, at the
+     * first voxel).
+     * @param sx (modified) the size of the volume along x.
+     * @param sy (modified) the size of the volume along y.
+     * @param sz (modified) the size of the volume along z.
+     */
+    static void readHeader( FILE * fin, int & sx, int & sy, int & sz )
+      throw( DGtal::IOException );
     
    
     
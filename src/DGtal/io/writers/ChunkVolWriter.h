@@ -0,0 +1,150 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChunkVolWriter.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/25
+ *
+ * Header file for module ChunkVolWriter.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ChunkVolWriter_RECURSES)
+#error Recursive header files inclusion detected in ChunkVolWriter.h
+#else // defined(ChunkVolWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChunkVolWriter_RECURSES
+
+#if !defined ChunkVolWriter_h
+/** Prevents repeated inclusion of headers. */
+#define ChunkVolWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <cstdio>
+#include <vector>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/ChunkVolFormat.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ChunkVolWriter
+  /**
+   * Description of template struct 'ChunkVolWriter' <p>
+   * \brief Aim: Export a 3D Image in the "chunked volume" format (see
+   * ChunkVolFormat), and update parts of an exported volume.
+   *
+   * The values are written as they are (no colormap), so that label
+   * images are exported without loss. The bricks are compressed
+   * independently: if DGtal is built with OpenMP (WITH_OPENMP), the
+   * bricks of each plane of bricks are compressed by several threads,
+   * then written in order.
+   *
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> Image;
+   * ChunkVolWriter<Image>::exportChunkVol( "labels.cvol", labels, 32, 4 );
+   * @endcode
+   *
+   * @tparam TImage the Image type (3D).
+   *
+   * @see ChunkVolReader
+   * @see testChunkVol.cpp
+   */
+  template <typename TImage>
+  struct ChunkVolWriter
+  {
+    // ----------------------- Standard services ------------------------------
+
+    BOOST_STATIC_ASSERT(TImage::Domain::dimension == 3);
+
+    typedef TImage Image;
+    typedef typename TImage::Value Value;
+    typedef typename TImage::Domain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Integer Integer;
+
+    /** 
+     * Export an Image in the chunked volume format. The lower bound
+     * of the image is the origin of the volume.
+     * 
+     * @param filename name of the output file
+     * @param aImage the image to export
+     * @param brickSize the size of the (cubic) bricks.
+     * @param nbThreads the number of threads compressing the bricks
+     * (0 means the OpenMP default, ignored without OpenMP).
+     * 
+     * @return true if no errors occur.
+     */
+    static bool exportChunkVol(const std::string & filename, const Image &aImage,
+             const Integer brickSize = 32,
+             const unsigned int nbThreads = 1) throw(DGtal::IOException);
+
+    /** 
+     * Replaces the values of an exported volume inside a domain. The
+     * updated bricks are appended to the file and the index is
+     * updated, their previous data is left unused in the file (an
+     * import followed by an export gives a compact file again).
+     * 
+     * @param filename name of the file to update
+     * @param aImage the new values (its domain contains @a aDomain).
+     * @param aDomain the updated points (clipped to the volume).
+     * 
+     * @return true if no errors occur.
+     */
+    static bool updateChunkVol(const std::string & filename, const Image &aImage,
+             const Domain & aDomain) throw(DGtal::IOException);
+
+  private:
+
+    /** 
+     * Copies the values of a brick in scan order.
+     * 
+     * @param aImage the image.
+     * @param origin the point of the image at the origin of the volume.
+     * @param lower the lower bound of the brick (in the volume).
+     * @param upper the upper bound of the brick (in the volume).
+     * @param values (modified) the values.
+     */
+    static void brickValues(const Image & aImage, const Point & origin,
+          const Point & lower, const Point & upper,
+          std::vector<Value> & values);
+    
+  };
+}//namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/ChunkVolWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChunkVolWriter_h
+
+#undef ChunkVolWriter_RECURSES
+#endif // else defined(ChunkVolWriter_RECURSES)
@@ -0,0 +1,177 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ColormapGrayConverter.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/26
+ *
+ * Header file for module ColormapGrayConverter.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ColormapGrayConverter_RECURSES)
+#error Recursive header files inclusion detected in ColormapGrayConverter.h
+#else // defined(ColormapGrayConverter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ColormapGrayConverter_RECURSES
+
+#if !defined ColormapGrayConverter_h
+/** Prevents repeated inclusion of headers. */
+#define ColormapGrayConverter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/type_traits.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/Color.h"
+#include "DGtal/io/colormaps/CColorMap.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ColormapGrayConverter
+  /**
+   * Description of template class 'ColormapGrayConverter' <p>
+   * \brief Aim: converts values to 8bits gray levels through a
+   * colormap, as done by the Vol and Raw writers: Value
+   * --<colormap>--> Board::Color ----> (red+green+blue)/3.
+   *
+   * When the values are integers and the range [minV,maxV] has less
+   * than 2^16 values, the gray levels of the whole range are computed
+   * once in a lookup table, so that the conversion of a value is a
+   * single memory access. Values out of the range (or of non integral
+   * types) go through the colormap. In both cases, the result is the
+   * same as the colormap one.
+   *
+   * @tparam TColormap the type of the colormap.
+   */
+  template <typename TColormap>
+  class ColormapGrayConverter
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    BOOST_CONCEPT_ASSERT((CColorMap<TColormap>));
+
+    typedef TColormap Colormap;
+    typedef typename Colormap::Value Value;
+    typedef typename boost::is_integral<Value>::type IsIntegral;
+
+    /// Maximal number of values of the lookup table.
+    static const unsigned int MAX_TABLE_SIZE = 65536;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Builds the lookup table if possible.
+     *
+     * @param minV the minimum value (for colormap).
+     * @param maxV the maximum value (for colormap).
+     */
+    ColormapGrayConverter( const Value & minV, const Value & maxV );
+
+    /**
+     * @param aValue any value.
+     * @return the gray level of the color of @a aValue.
+     */
+    unsigned char operator()( const Value & aValue ) const;
+
+    /**
+     * @param aColor any color.
+     * @return the gray level of @a aColor (mean of its components).
+     */
+    static unsigned char gray( const Color & aColor );
+
+    /**
+     * @return 'true' if the conversion uses a lookup table.
+     */
+    bool hasTable() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The colormap.
+    Colormap myColormap;
+    /// Minimum value.
+    Value myMin;
+    /// Maximum value.
+    Value myMax;
+    /// Gray levels of the values of [myMin,myMax] (may be empty).
+    std::vector<unsigned char> myTable;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Fills the table (integral values).
+    void buildTable( boost::true_type );
+    /// Does nothing (non integral values).
+    void buildTable( boost::false_type );
+    /// Conversion with the table (integral values).
+    unsigned char convert( const Value & aValue, boost::true_type ) const;
+    /// Conversion with the colormap (non integral values).
+    unsigned char convert( const Value & aValue, boost::false_type ) const;
+
+  }; // end of class ColormapGrayConverter
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ColormapGrayConverter'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ColormapGrayConverter' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TColormap>
+  std::ostream&
+  operator<< ( std::ostream & out, const ColormapGrayConverter<TColormap> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/ColormapGrayConverter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ColormapGrayConverter_h
+
+#undef ColormapGrayConverter_RECURSES
+#endif // else defined(ColormapGrayConverter_RECURSES)
@@ -46,6 +46,7 @@
 #include <boost/type_traits.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/io/colormaps/CColorMap.h"
+#include "DGtal/io/writers/ColormapGrayConverter.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -82,11 +83,42 @@ namespace DGtal
      * @param aImage the image to export
      * @param minV the minimum value of aImage (for colormap)
      * @param maxV the maximum value of aImage (for colormap) 
+     * @param nbThreads the number of threads used for the conversion
+     * of the values (0 for the OpenMP default, ignored without OpenMP).
      * 
      * @return true if no errors occur.
      */
     static bool exportRaw8(const std::string & filename, const Image &aImage, 
-        const Value & minV, const Value & maxV);
+        const Value & minV, const Value & maxV,
+        const unsigned int nbThreads = 1);
+
+    /** 
+     * Writes the values of the points of a domain, in its scan order
+     * (first dimension first), as in the Raw format (8bits).
+     * Exporting an image in several calls, domain after domain, gives
+     * the same file as a single call.
+     *
+     * The values are converted by batches of rows (lines along the
+     * first dimension) into a buffer of about BUFFER_SIZE bytes, which
+     * is written at once. The conversion goes through a
+     * ColormapGrayConverter (lookup table for small integral ranges)
+     * and the rows of a batch may be shared between several threads.
+     * 
+     * @param out the output stream (opened in binary mode).
+     * @param aImage the image to export.
+     * @param aDomain the exported points (included in the domain of aImage).
+     * @param minV the minimum value of aImage (for colormap)
+     * @param maxV the maximum value of aImage (for colormap) 
+     * @param nbThreads the number of threads used for the conversion
+     * of the values (0 for the OpenMP default, ignored without OpenMP).
+     */
+    static void exportValues(std::ostream & out, const Image &aImage, 
+           const typename Image::Domain & aDomain,
+           const Value & minV, const Value & maxV,
+           const unsigned int nbThreads = 1);
+
+    /// Size (in bytes) of the output buffer of exportValues.
+    static const unsigned int BUFFER_SIZE = 1 << 22;
     
   };
 }//namespace
@@ -0,0 +1,206 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SlabWriter.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/23
+ *
+ * Header file for module SlabWriter.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SlabWriter_RECURSES)
+#error Recursive header files inclusion detected in SlabWriter.h
+#else // defined(SlabWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SlabWriter_RECURSES
+
+#if !defined SlabWriter_h
+/** Prevents repeated inclusion of headers. */
+#define SlabWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/writers/VolWriter.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SlabWriter
+  /**
+   * Description of template class 'SlabWriter' <p>
+   * \brief Aim: writes a 3D "Vol" or "Raw" (8bits) file slab by
+   * slab, the slabs being given in increasing z order (see
+   * SlabReader).
+   *
+   * The values are converted as in VolWriter and RawWriter: Value
+   * --<colormap>--> Color ----> unsigned char. Once all the slabs
+   * have been written, the file is the same as the one exported by
+   * VolWriter::exportVol (or RawWriter::exportRaw8) from the whole
+   * image.
+   *
+   * @tparam TImage the Image type of the slabs (3D).
+   * @tparam TColormap the type of the colormap to use in the export.
+   *
+   * @see SlabReader, SlabProcessing
+   * @see testSlabProcessing.cpp
+   */
+  template <typename TImage, typename TColormap>
+  class SlabWriter
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TImage Image;
+    typedef typename TImage::Value Value;
+    typedef typename TImage::Domain Domain;
+    typedef typename Domain::Vector Vector;
+    typedef TColormap Colormap;
+
+    BOOST_STATIC_ASSERT(Domain::dimension == 3);
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param minV the minimum value of the whole image (for colormap)
+     * @param maxV the maximum value of the whole image (for colormap)
+     */
+    SlabWriter( const Value & minV, const Value & maxV );
+
+    /**
+     * Destructor. Closes the file.
+     */
+    ~SlabWriter();
+
+    /**
+     * Sets the range of the colormap.
+     *
+     * @param minV the minimum value of the whole image.
+     * @param maxV the maximum value of the whole image.
+     */
+    void setValueRange( const Value & minV, const Value & maxV );
+
+    /**
+     * Creates a Vol file and writes its header.
+     *
+     * @param filename the file name.
+     * @param extent the extent of the whole image.
+     */
+    void openVol( const std::string & filename, const Vector & extent )
+      throw( DGtal::IOException );
+
+    /**
+     * Creates a Raw (8bits) file.
+     *
+     * @param filename the file name.
+     */
+    void openRaw8( const std::string & filename ) throw( DGtal::IOException );
+
+    /**
+     * Appends the values of a slab to the file.
+     *
+     * @param aSlab an image containing @a aCore.
+     * @param aCore the planes to write (the planes following the
+     * ones previously written).
+     */
+    void write( const Image & aSlab, const Domain & aCore )
+      throw( DGtal::IOException );
+
+    /**
+     * Closes the file.
+     */
+    void close();
+
+    /**
+     * @return the number of values written since the file was opened.
+     */
+    std::size_t count() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The output file.
+    std::ofstream myOut;
+    /// Minimum value of the colormap.
+    Value myMin;
+    /// Maximum value of the colormap.
+    Value myMax;
+    /// Number of values written.
+    std::size_t myCount;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    SlabWriter();
+    SlabWriter( const SlabWriter & other );
+    SlabWriter & operator= ( const SlabWriter & other );
+
+  }; // end of class SlabWriter
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SlabWriter'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SlabWriter' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage, typename TColormap>
+  std::ostream&
+  operator<< ( std::ostream & out, const SlabWriter<TImage, TColormap> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/SlabWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SlabWriter_h
+
+#undef SlabWriter_RECURSES
+#endif // else defined(SlabWriter_RECURSES)
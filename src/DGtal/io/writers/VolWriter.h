@@ -46,6 +46,7 @@
 #include <boost/type_traits.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/io/colormaps/CColorMap.h"
+#include "DGtal/io/writers/RawWriter.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -83,11 +84,45 @@ namespace DGtal
      * @param aImage the image to export
      * @param minV the minimum value of aImage (for colormap)
      * @param maxV the maximum value of aImage (for colormap) 
+     * @param nbThreads the number of threads used for the conversion
+     * of the values (0 for the OpenMP default, ignored without OpenMP).
      * 
      * @return true if no errors occur.
      */
     static bool exportVol(const std::string & filename, const Image &aImage, 
-        const Value & minV, const Value & maxV) throw(DGtal::IOException);
+        const Value & minV, const Value & maxV,
+        const unsigned int nbThreads = 1) throw(DGtal::IOException);
+
+    /** 
+     * Writes the header of a Vol file. The values (sx*sy*sz bytes)
+     * should follow, e.g. written with exportValues.
+     * 
+     * @param out the output stream (opened in binary mode).
+     * @param ext the extent of the image.
+     */
+    static void exportHeader(std::ostream & out, 
+           const typename Image::Domain::Vector & ext);
+
+    /** 
+     * Writes the values of the points of a domain, in its scan order
+     * (first dimension first), as in the Vol format. The pipeline can
+     * be sketched as follows: Value --<colormap>--> Board::Color
+     * ----> unsigned char. Exporting an image in several calls, domain
+     * after domain, gives the same file as a single call. The values
+     * are the ones of a Raw (8bits) file, see RawWriter::exportValues.
+     * 
+     * @param out the output stream (opened in binary mode).
+     * @param aImage the image to export.
+     * @param aDomain the exported points (included in the domain of aImage).
+     * @param minV the minimum value of aImage (for colormap)
+     * @param maxV the maximum value of aImage (for colormap) 
+     * @param nbThreads the number of threads used for the conversion
+     * of the values (0 for the OpenMP default, ignored without OpenMP).
+     */
+    static void exportValues(std::ostream & out, const Image &aImage, 
+           const typename Image::Domain & aDomain,
+           const Value & minV, const Value & maxV,
+           const unsigned int nbThreads = 1);
     
   };
 }//namespace
@@ -0,0 +1,549 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByBitset.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/05/12
+ *
+ * Header file for module DigitalSetByBitset.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByBitset_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByBitset.h
+#else // defined(DigitalSetByBitset_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByBitset_RECURSES
+
+#if !defined DigitalSetByBitset_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByBitset_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <string>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+#include "DGtal/io/Display3D.h"
+
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByBitset
+  /**
+   * Description of template class 'DigitalSetByBitset' <p>
+   * \brief Aim: A digital set represented by a packed array of bits,
+   * one per point of its (bounded) domain, for large and dense sets.
+   *
+   * The bit of a point is found at the linear index of the point in
+   * the domain (first coordinate first, as in a HyperRectDomain
+   * iteration or an ImageContainerBySTLVector). Hence insert, erase
+   * and find are in O(1), union, intersection and complement are
+   * computed 64 points at a time, and the iteration visits the points
+   * in the domain order while skipping the empty words. The memory
+   * used is one bit per point of the domain, whatever the size of the
+   * set.
+   *
+   * The iterators are constant (Iterator and ConstIterator are the
+   * same type); erasing a point only invalidates the iterators on
+   * this point.
+   *
+   * It is selected by DigitalSetSelector for the BIG_DS+HIGH_BEL_DS
+   * and WHOLE_DS+HIGH_BEL_DS preferences on a HyperRectDomain.
+   *
+   * Model of CDigitalSet.
+   *
+   * @tparam TDomain a HyperRectDomain (lowerBound(), upperBound() and
+   * isInside() are used).
+   *
+   * @see testDigitalSet.cpp
+   */
+  template <typename TDomain>
+  class DigitalSetByBitset
+  {
+  public:
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Space Space;
+    typedef typename Space::Dimension Dimension;
+
+    /// Type of the words of the bit array.
+    typedef DGtal::uint64_t Word;
+
+    /**
+     * Forward constant iterator on the points of the set, in the
+     * domain order.
+     */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Point value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Point* pointer;
+      typedef const Point& reference;
+
+      /**
+       * Default constructor (singular iterator).
+       */
+      ConstIterator()
+        : mySet( 0 ), myIndex( 0 )
+      {}
+
+      /**
+       * Constructor.
+       * @param aSet the set.
+       * @param index the linear index of a point of the set, or the
+       * number of points of the domain for end().
+       */
+      ConstIterator( const DigitalSetByBitset* aSet, const Size index )
+        : mySet( aSet ), myIndex( index )
+      {
+        if ( myIndex < mySet->myNbPoints )
+          myPoint = mySet->pointFromIndex( myIndex );
+      }
+
+      const Point & operator*() const
+      {
+        return myPoint;
+      }
+
+      const Point* operator->() const
+      {
+        return &myPoint;
+      }
+
+      ConstIterator & operator++()
+      {
+        Size next = mySet->nextIndex( myIndex + 1 );
+        if ( next < mySet->myNbPoints )
+          mySet->advancePoint( myPoint, next - myIndex );
+        myIndex = next;
+        return *this;
+      }
+
+      ConstIterator operator++( int )
+      {
+        ConstIterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+      bool operator==( const ConstIterator & other ) const
+      {
+        return myIndex == other.myIndex;
+      }
+
+      bool operator!=( const ConstIterator & other ) const
+      {
+        return myIndex != other.myIndex;
+      }
+
+      /**
+       * @return the linear index of the current point in the domain.
+       */
+      Size index() const
+      {
+        return myIndex;
+      }
+
+    private:
+      const DigitalSetByBitset* mySet;
+      Size myIndex;
+      Point myPoint;
+    };
+
+    typedef ConstIterator Iterator;
+    friend class ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByBitset();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByBitset( const Domain & d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByBitset ( const DigitalSetByBitset & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitset & operator= ( const DigitalSetByBitset & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set.
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * Note: generally faster than giving just the point.
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     */
+    DigitalSetByBitset<Domain> & operator+=
+    ( const DigitalSetByBitset<Domain> & aSet );
+
+    /**
+     * set intersection to left.
+     * @param aSet any other set.
+     */
+    DigitalSetByBitset<Domain> & operator*=
+    ( const DigitalSetByBitset<Domain> & aSet );
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * @return the complement of this set in the domain.
+     *
+     * NB: be aware of the overhead cost when returning the object.
+     */
+    DigitalSetByBitset<Domain> computeComplement() const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByBitset<Domain> & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    /**
+     * @return the words of the bit array (the bit i%64 of the word
+     * i/64 is the point of linear index i).
+     */
+    const std::vector<Word> & words() const;
+
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain;
+     */
+    const Domain & myDomain;
+
+    /// Lower bound of the domain.
+    Point myLower;
+
+    /// Extent of the domain along each dimension.
+    Point myExtent;
+
+    /// Number of points of the domain.
+    Size myNbPoints;
+
+    /// Number of points of the set.
+    Size mySize;
+
+    /// The bits (the bits after myNbPoints are always 0).
+    std::vector<Word> myWords;
+
+
+  public:
+    /**
+     * Default style.
+     */
+    struct DefaultDrawStyle : public DrawableWithBoard2D
+    {
+      virtual void selfDraw(Board2D & aBoard) const
+      {
+  aBoard.setFillColorRGBi(160,160,160);
+  aBoard.setPenColorRGBi(80,80,80);
+      }
+    };
+
+    // --------------- CDrawableWithBoard2D realization ---------------------
+  public:
+
+    /**
+     * Default drawing style object.
+     * @return the dyn. alloc. default style for this object.
+     */
+    DrawableWithBoard2D* defaultStyle( std::string mode = "" ) const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string styleName() const;
+
+    /**
+     * Draw the object on a Board2D board.
+     * @param board the output board where the object is drawn.
+     */
+    void selfDraw(Board2D & board ) const;
+
+
+     /**
+     * Default style.
+     */
+    struct DefaultDrawStyleDisplay3D : public  DrawableWithDisplay3D
+    {
+       virtual void selfDrawDisplay3D(Display3D & display) const
+        {
+    display.myModes[ "DigitalSetByBitset" ] = "";
+  }
+
+    };
+
+    /**
+     * Default drawing style object.
+     * @return the dyn. alloc. default style for this object.
+     */
+  DrawableWithDisplay3D* defaultStyleDisplay3D( std::string mode = "" ) const;
+
+    /**
+     * Draw the object on a Display3D.
+     * @param display the output display where the object is drawn.
+     */
+    void selfDrawDisplay3D(  Display3D & display ) const;
+    void selfDrawAsGridDisplay3D( Display3D & display  ) const;
+    void selfDrawAsPavingDisplay3D( Display3D & display ) const;
+    void selfDrawAsPavingTransparentDisplay3D( Display3D & display ) const;
+
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByBitset();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param p any point of the domain.
+     * @return its linear index.
+     */
+    Size linearIndex( const Point & p ) const;
+
+    /**
+     * @param index a linear index (less than myNbPoints).
+     * @return the corresponding point.
+     */
+    Point pointFromIndex( Size index ) const;
+
+    /**
+     * Moves a point of the domain @a delta positions forward in the
+     * domain order.
+     * @param p (modified) any point of the domain.
+     * @param delta the shift of linear index.
+     */
+    void advancePoint( Point & p, Size delta ) const;
+
+    /**
+     * @param index any linear index.
+     * @return the smallest index of a point of the set greater or
+     * equal to @a index, or myNbPoints if there is none.
+     */
+    Size nextIndex( Size index ) const;
+
+    /**
+     * Copies the bits of a set with the same domain bounds, or inserts
+     * its points one by one otherwise.
+     * @param other any set.
+     */
+    void assignPoints( const DigitalSetByBitset & other );
+
+    /**
+     * Clears the unused bits of the last word and recounts the points.
+     */
+    void updateSize();
+
+  }; // end of class DigitalSetByBitset
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByBitset'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByBitset' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out, const DigitalSetByBitset<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByBitset.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByBitset_h
+
+#undef DigitalSetByBitset_RECURSES
+#endif // else defined(DigitalSetByBitset_RECURSES)
@@ -48,11 +48,14 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
 
+  template <typename TSpace> class HyperRectDomain;
+
   // ----------------------- Related enumerations -----------------------------
   enum DigitalSetSize { SMALL_DS = 0, MEDIUM_DS = 1, BIG_DS = 2, WHOLE_DS = 3 };
   enum DigitalSetVariability { LOW_VAR_DS = 0, HIGH_VAR_DS = 4 };
@@ -80,6 +83,11 @@ namespace DGtal
    SpecificSet set1( domain );
    *
    * @endcode
+   *
+   * Big (or whole) sets with frequent membership tests in a
+   * HyperRectDomain are represented by a DigitalSetByBitset, small
+   * sets with a low variability by a DigitalSetBySTLVector, and the
+   * other ones by a DigitalSetBySTLSet.
    */
   template <typename Domain, int Preferences >
   struct DigitalSetSelector
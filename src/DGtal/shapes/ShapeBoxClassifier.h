@@ -0,0 +1,155 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+
+#pragma once
+
+/**
+ * @file ShapeBoxClassifier.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/06/03
+ *
+ * Header file for module ShapeBoxClassifier.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ShapeBoxClassifier_RECURSES)
+#error Recursive header files inclusion detected in ShapeBoxClassifier.h
+#else // defined(ShapeBoxClassifier_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ShapeBoxClassifier_RECURSES
+
+#if !defined ShapeBoxClassifier_h
+/** Prevents repeated inclusion of headers. */
+#define ShapeBoxClassifier_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <boost/type_traits.hpp>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /**
+   * Location of an axis-aligned box with respect to a shape: all its
+   * points are inside the shape, all its points are outside the
+   * shape, or it may contain points of both kinds.
+   */
+  enum BoxLocation { BOX_INSIDE, BOX_OUTSIDE, BOX_ON_BOUNDARY };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ShapeBoxClassifier
+  /**
+   * Description of template class 'ShapeBoxClassifier' <p> \brief
+   * Aim: Classifies whole boxes with respect to a shape, so that
+   * digitizers (see Shapes::shaper) may fill or skip a box without
+   * evaluating each of its points.
+   *
+   * A box is given by its lowest and highest points, which are both
+   * in the box. The classification must be conservative: a box is
+   * BOX_INSIDE (resp. BOX_OUTSIDE) only if \c isInside is true
+   * (resp. false) for all its points, and BOX_ON_BOUNDARY whenever
+   * this is not known.
+   *
+   * \a Supported is boost::false_type and every box is on the
+   * boundary for this default version. Shapes that can do better
+   * specialize it, usually with MemberShapeBoxClassifier.
+   *
+   * @tparam TShape any model of CShape.
+   */
+  template <typename TShape>
+  struct ShapeBoxClassifier
+  {
+    typedef boost::false_type Supported;
+
+    /**
+     * @param shape any shape.
+     * @param lower the lowest point of the box.
+     * @param upper the highest point of the box.
+     * @return BOX_ON_BOUNDARY.
+     */
+    template <typename TPoint>
+    static BoxLocation classify( const TShape & shape,
+                                 const TPoint & lower,
+                                 const TPoint & upper );
+  };
+
+  /**
+   * Aim: A ShapeBoxClassifier for the shapes having a method
+   * @code BoxLocation boxLocation( const Point & lower, const Point & upper ) const @endcode
+   *
+   * @tparam TShape any model of CShape with such a method.
+   */
+  template <typename TShape>
+  struct MemberShapeBoxClassifier
+  {
+    typedef boost::true_type Supported;
+
+    /**
+     * @param shape any shape.
+     * @param lower the lowest point of the box.
+     * @param upper the highest point of the box.
+     * @return the location of the box with respect to [shape].
+     */
+    template <typename TPoint>
+    static BoxLocation classify( const TShape & shape,
+                                 const TPoint & lower,
+                                 const TPoint & upper );
+  };
+
+  /**
+   * Classifies a box with respect to a shape whose points are
+   * inside iff some function of |p_k - c_k| (k=0..n-1), which is
+   * non-increasing in each of them, is above a threshold. The box is
+   * then inside iff its point farthest from the center in each
+   * direction is inside, and outside iff its point nearest to the
+   * center is outside, which costs two calls to \c isInside.
+   *
+   * @tparam TShape any model of CShape.
+   * @tparam TPoint the type of its points.
+   *
+   * @param shape the shape.
+   * @param center the center c of the shape.
+   * @param lower the lowest point of the box.
+   * @param upper the highest point of the box.
+   * @return the location of the box with respect to [shape].
+   */
+  template <typename TShape, typename TPoint>
+  BoxLocation centeredBoxLocation( const TShape & shape,
+                                   const TPoint & center,
+                                   const TPoint & lower,
+                                   const TPoint & upper );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/ShapeBoxClassifier.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ShapeBoxClassifier_h
+
+#undef ShapeBoxClassifier_RECURSES
+#endif // else defined(ShapeBoxClassifier_RECURSES)
@@ -41,9 +41,12 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <boost/type_traits.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/domains/CDomain.h"
 #include "DGtal/shapes/CShape.h"
+#include "DGtal/shapes/ShapeBoxClassifier.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -83,13 +86,26 @@ namespace DGtal
     /** 
      * Adds to the (perhaps non empty) set [aSet] an shape defined by
      * an instance of ShapeFunctor.
+     *
+     * When the boxes of the shape can be classified (see
+     * ShapeBoxClassifier), its bounding box is cut into tiles which
+     * are recursively subdivided: boxes inside the shape are added
+     * without evaluating their points, boxes outside are skipped, and
+     * only the small boxes meeting the boundary are evaluated point
+     * by point. The tiles may then be digitized by several threads
+     * (with OpenMP). Otherwise, every point of the bounding box is
+     * evaluated.
      * 
      * @param aSet the set (modified) which will contain the shape.
      * @param aFunctor a functor defining the shape.
+     * @param nbThreads the number of threads digitizing the tiles,
+     * 0 meaning as many as OpenMP chooses (1 by default, ignored
+     * without OpenMP).
      */
     template <typename TDigitalSet, typename TShapeFunctor>
     static void shaper( TDigitalSet & aSet,
-      const TShapeFunctor & aFunctor);
+      const TShapeFunctor & aFunctor,
+      unsigned int nbThreads = 1 );
     
     /**
      * Adds the discrete ball (norm-1) of center [aCenter] and radius
@@ -187,6 +203,43 @@ namespace DGtal
      */
     Shapes();
 
+    /**
+     * Digitization evaluating every point of the bounding box.
+     *
+     * @param aSet the set (modified) which will contain the shape.
+     * @param aFunctor a functor defining the shape.
+     */
+    template <typename TDigitalSet, typename TShapeFunctor>
+    static void shaper( TDigitalSet & aSet,
+      const TShapeFunctor & aFunctor,
+      unsigned int nbThreads, boost::false_type );
+
+    /**
+     * Hierarchical digitization, tile by tile.
+     *
+     * @param aSet the set (modified) which will contain the shape.
+     * @param aFunctor a functor defining the shape.
+     * @param nbThreads the number of threads digitizing the tiles.
+     */
+    template <typename TDigitalSet, typename TShapeFunctor>
+    static void shaper( TDigitalSet & aSet,
+      const TShapeFunctor & aFunctor,
+      unsigned int nbThreads, boost::true_type );
+
+    /**
+     * Appends to [points] the points of the box [lower,upper] that
+     * are inside the shape, by recursive subdivision of the box.
+     *
+     * @param aFunctor a functor defining the shape.
+     * @param lower the lowest point of the box.
+     * @param upper the highest point of the box.
+     * @param points (modified) the points inside the shape.
+     */
+    template <typename TShapeFunctor>
+    static void digitizeBox( const TShapeFunctor & aFunctor,
+           const Point & lower, const Point & upper,
+           std::vector<Point> & points );
+
   private:
 
     /**
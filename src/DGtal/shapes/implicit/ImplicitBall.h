@@ -42,6 +42,7 @@
 // Inclusions
 #include <iostream>
 #include "DGtal/base/Common.h"
+#include "DGtal/shapes/ShapeBoxClassifier.h"
 #include "DGtal/kernel/NumberTraits.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -113,6 +114,20 @@ namespace DGtal
     {
       return (myCenter + Point::diagonal(myRadius)); 
     }
+
+    /**
+     * The Euclidean distance to the center is non-decreasing in each
+     * |p_k - c_k|, so centeredBoxLocation is exact.
+     *
+     * @param lower the lowest point of the box.
+     * @param upper the highest point of the box.
+     * @return the location of the box with respect to the shape.
+     */
+    inline
+    BoxLocation boxLocation( const Point & lower, const Point & upper ) const
+    {
+      return centeredBoxLocation( *this, myCenter, lower, upper );
+    }
     
 
 
@@ -164,6 +179,11 @@ namespace DGtal
     
   }; // end of class ImplicitBall
 
+  template <typename TSpace>
+  struct ShapeBoxClassifier< ImplicitBall<TSpace> >
+    : public MemberShapeBoxClassifier< ImplicitBall<TSpace> >
+  {};
+
 
   /**
    * Overloads 'operator<<' for displaying objects of class 'ImplicitBall'.
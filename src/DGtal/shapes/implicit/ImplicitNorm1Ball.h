@@ -42,6 +42,7 @@
 // Inclusions
 #include <iostream>
 #include "DGtal/base/Common.h"
+#include "DGtal/shapes/ShapeBoxClassifier.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -137,6 +138,20 @@ namespace DGtal
     {
       return (myCenter + Point::diagonal(myHalfWidth)); 
     }
+
+    /**
+     * The L1 distance to the center is non-decreasing in each
+     * |p_k - c_k|, so centeredBoxLocation is exact.
+     *
+     * @param lower the lowest point of the box.
+     * @param upper the highest point of the box.
+     * @return the location of the box with respect to the shape.
+     */
+    inline
+    BoxLocation boxLocation( const Point & lower, const Point & upper ) const
+    {
+      return centeredBoxLocation( *this, myCenter, lower, upper );
+    }
     
     // ----------------------- Interface --------------------------------------
   public:
@@ -186,6 +201,11 @@ namespace DGtal
     
   }; // end of class ImplicitNorm1Ball
 
+  template <typename TSpace>
+  struct ShapeBoxClassifier< ImplicitNorm1Ball<TSpace> >
+    : public MemberShapeBoxClassifier< ImplicitNorm1Ball<TSpace> >
+  {};
+
 
   /**
    * Overloads 'operator<<' for displaying objects of class 'ImplicitNorm1Ball'.
@@ -42,6 +42,7 @@
 // Inclusions
 #include <iostream>
 #include "DGtal/base/Common.h"
+#include "DGtal/shapes/ShapeBoxClassifier.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -149,6 +150,20 @@ namespace DGtal
     {
       return (myCenter + Point::diagonal(myHalfWidth)); 
     }
+
+    /**
+     * The sum of the |p_k - c_k|^myPower is non-decreasing in each
+     * |p_k - c_k|, so centeredBoxLocation is exact.
+     *
+     * @param lower the lowest point of the box.
+     * @param upper the highest point of the box.
+     * @return the location of the box with respect to the shape.
+     */
+    inline
+    BoxLocation boxLocation( const Point & lower, const Point & upper ) const
+    {
+      return centeredBoxLocation( *this, myCenter, lower, upper );
+    }
     
     // ----------------------- Interface --------------------------------------
   public:
@@ -201,6 +216,11 @@ namespace DGtal
     
   }; // end of class ImplicitRoundedHyperCube
 
+  template <typename TSpace>
+  struct ShapeBoxClassifier< ImplicitRoundedHyperCube<TSpace> >
+    : public MemberShapeBoxClassifier< ImplicitRoundedHyperCube<TSpace> >
+  {};
+
 
   /**
    * Overloads 'operator<<' for displaying objects of class 'ImplicitRoundedHyperCube'.
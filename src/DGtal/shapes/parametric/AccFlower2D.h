@@ -149,6 +149,23 @@ namespace DGtal
     {
       return myCenter;
     }
+
+    /**
+     * @return myRadius - |myVarRadius|, the minimum of the radius
+     * myRadius + myVarRadius cos( myKp t^3 ).
+     */
+    double innerRadius() const
+    {
+      return myRadius - std::abs( myVarRadius );
+    }
+
+    /**
+     * @return myRadius + |myVarRadius|, its maximum.
+     */
+    double outerRadius() const
+    {
+      return myRadius + std::abs( myVarRadius );
+    }
    
     /**
      * @param p any point in the plane.
@@ -263,6 +280,11 @@ namespace DGtal
 
   }; // end of class AccFlower2D
 
+  template <typename TSpace>
+  struct ShapeBoxClassifier< AccFlower2D<TSpace> >
+    : public MemberShapeBoxClassifier< AccFlower2D<TSpace> >
+  {};
+
 
   /**
    * Overloads 'operator<<' for displaying objects of class 'AccFlower2D'.
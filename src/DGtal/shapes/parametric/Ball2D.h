@@ -124,6 +124,22 @@ namespace DGtal
     {
       return myCenter;
     }
+
+    /**
+     * @return myRadius, the distance of the whole boundary to the center.
+     */
+    double innerRadius() const
+    {
+      return myRadius;
+    }
+
+    /**
+     * @return myRadius.
+     */
+    double outerRadius() const
+    {
+      return myRadius;
+    }
    
     /**
      * @param p any point in the plane.
@@ -218,6 +234,11 @@ namespace DGtal
 
   }; // end of class Ball2D
 
+  template <typename TSpace>
+  struct ShapeBoxClassifier< Ball2D<TSpace> >
+    : public MemberShapeBoxClassifier< Ball2D<TSpace> >
+  {};
+
 
   /**
    * Overloads 'operator<<' for displaying objects of class 'Ball2D'.
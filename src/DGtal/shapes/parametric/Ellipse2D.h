@@ -46,6 +46,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/shapes/parametric/StarShaped2D.h"
 #include <cmath>
+#include <algorithm>
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -137,6 +138,22 @@ namespace DGtal
     {
       return myCenter;
     }
+
+    /**
+     * @return the smaller half axis.
+     */
+    double innerRadius() const
+    {
+      return std::min( myAxis1, myAxis2 );
+    }
+
+    /**
+     * @return the larger half axis.
+     */
+    double outerRadius() const
+    {
+      return std::max( myAxis1, myAxis2 );
+    }
    
     /**
      * @param p any point in the plane.
@@ -242,6 +259,11 @@ namespace DGtal
 
   }; // end of class Ellipse2D
 
+  template <typename TSpace>
+  struct ShapeBoxClassifier< Ellipse2D<TSpace> >
+    : public MemberShapeBoxClassifier< Ellipse2D<TSpace> >
+  {};
+
 
   /**
    * Overloads 'operator<<' for displaying objects of class 'Ellipse2D'.
@@ -149,6 +149,23 @@ namespace DGtal
     {
       return myCenter;
     }
+
+    /**
+     * @return myRadius - |myVarRadius|, the minimum of the radius
+     * myRadius + myVarRadius cos( myK t + myPhi ).
+     */
+    double innerRadius() const
+    {
+      return myRadius - std::abs( myVarRadius );
+    }
+
+    /**
+     * @return myRadius + |myVarRadius|, its maximum.
+     */
+    double outerRadius() const
+    {
+      return myRadius + std::abs( myVarRadius );
+    }
    
     /**
      * @param p any point in the plane.
@@ -258,6 +275,11 @@ namespace DGtal
 
   }; // end of class Flower2D
 
+  template <typename TSpace>
+  struct ShapeBoxClassifier< Flower2D<TSpace> >
+    : public MemberShapeBoxClassifier< Flower2D<TSpace> >
+  {};
+
 
   /**
    * Overloads 'operator<<' for displaying objects of class 'Flower2D'.
@@ -137,6 +137,22 @@ namespace DGtal
     {
       return myCenter;
     }
+
+    /**
+     * @return the apothem myRadius cos( Pi / myK ).
+     */
+    double innerRadius() const
+    {
+      return myRadius * cos( M_PI / myK );
+    }
+
+    /**
+     * @return myRadius, the distance of the vertices to the center.
+     */
+    double outerRadius() const
+    {
+      return myRadius;
+    }
    
     /**
      * @param p any point in the plane.
@@ -243,6 +259,11 @@ namespace DGtal
 
   }; // end of class NGon2D
 
+  template <typename TSpace>
+  struct ShapeBoxClassifier< NGon2D<TSpace> >
+    : public MemberShapeBoxClassifier< NGon2D<TSpace> >
+  {};
+
 
   /**
    * Overloads 'operator<<' for displaying objects of class 'NGon2D'.
@@ -43,8 +43,10 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <limits>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/shapes/ShapeBoxClassifier.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -94,6 +96,24 @@ namespace DGtal
       return center();
     }
 
+    /**
+     * @return a radius r such that the disk of center center() and
+     * radius r is included in the shape, 0 by default.
+     */
+    virtual double innerRadius() const
+    {
+      return 0.0;
+    }
+
+    /**
+     * @return a radius R such that the shape is included in the disk
+     * of center center() and radius R, infinite by default.
+     */
+    virtual double outerRadius() const
+    {
+      return std::numeric_limits<double>::infinity();
+    }
+
     // ------------------------- Abstract services ----------------------------
   public:
     
@@ -167,6 +187,30 @@ namespace DGtal
      */
     bool isInside( const Point & p ) const;
 
+    /**
+     * Classifies a box by comparing its distances to the center with
+     * innerRadius() and outerRadius(), with some margin for the
+     * rounding errors of parameter() and x(). A derived shape that
+     * overrides both radii specializes ShapeBoxClassifier with
+     * MemberShapeBoxClassifier to be digitized by boxes in
+     * Shapes::shaper.
+     *
+     * @param lower the lowest point of the box.
+     * @param upper the highest point of the box.
+     * @return the location of the box with respect to the shape.
+     */
+    BoxLocation boxLocation( const RealPoint & lower,
+                             const RealPoint & upper ) const;
+
+    /**
+     * Classifies a box of the digital plane.
+     *
+     * @param lower the lowest point of the box.
+     * @param upper the highest point of the box.
+     * @return the location of the box with respect to the shape.
+     */
+    BoxLocation boxLocation( const Point & lower, const Point & upper ) const;
+
     
     /**
      * @param t any angle between 0 and 2*Pi.
@@ -0,0 +1,540 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CellHashSet.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/05/16
+ *
+ * Header file for module CellHashSet.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CellHashSet_RECURSES)
+#error Recursive header files inclusion detected in CellHashSet.h
+#else // defined(CellHashSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CellHashSet_RECURSES
+
+#if !defined CellHashSet_h
+/** Prevents repeated inclusion of headers. */
+#define CellHashSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskyCellHash.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+    /// Entries of a CellHashSet: the cells themselves.
+    template <typename TCell>
+    struct CellHashSetEntry
+    {
+      typedef TCell Entry;
+      static const TCell & cell( const Entry & e ) { return e; }
+    };
+
+    /// Entries of a CellHashMap: pairs (cell, value).
+    template <typename TCell, typename TValue>
+    struct CellHashMapEntry
+    {
+      typedef std::pair<TCell, TValue> Entry;
+      static const TCell & cell( const Entry & e ) { return e.first; }
+    };
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CellHashTable
+  /**
+     Description of template class 'CellHashTable' <p> \brief Aim:
+     Open addressing hash table of cells (or signed cells) of a
+     cellular grid space, base of CellHashSet and CellHashMap.
+
+     The entries are stored in a flat array whose size is a power of
+     two, with linear probing from the slot given by the high bits of
+     the hashed key (see KhalimskyCellHash). The key of each entry is
+     stored beside, so that a probe only compares integers, cells
+     being compared only when their keys are equal. The table is
+     doubled when it is half full. Erasing shifts back the following
+     entries of the probe sequence, so that there are no tombstones.
+     Insertion, search and deletion are thus in O(1) expected time.
+
+     NB: inserting may invalidate the iterators (when the table
+     grows), erasing may move an entry into the erased slot.
+
+     @tparam TKSpace the type of cellular grid space (e.g. a
+     KhalimskySpaceND).
+     @tparam TCell either TKSpace::Cell or TKSpace::SCell.
+     @tparam TEntryTraits gives the type of the entries and their cell.
+   */
+  template <typename TKSpace, typename TCell, typename TEntryTraits>
+  class CellHashTable
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TKSpace KSpace;
+    typedef TCell Cell;
+    typedef typename TEntryTraits::Entry Entry;
+    typedef KhalimskyCellHash<KSpace> Hash;
+    typedef typename Hash::Key Key;
+    typedef std::size_t Size;
+
+    class ConstIterator;
+
+    /**
+       Forward iterator on the entries of the table.
+    */
+    class Iterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Entry value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef Entry* pointer;
+      typedef Entry& reference;
+
+      Iterator()
+        : myTable( 0 ), myIndex( 0 )
+      {}
+
+      Iterator( CellHashTable* aTable, const Size index )
+        : myTable( aTable ), myIndex( index )
+      {}
+
+      Entry & operator*() const
+      {
+        return myTable->myEntries[ myIndex ];
+      }
+
+      Entry* operator->() const
+      {
+        return &( myTable->myEntries[ myIndex ] );
+      }
+
+      Iterator & operator++()
+      {
+        myIndex = myTable->nextUsed( myIndex + 1 );
+        return *this;
+      }
+
+      Iterator operator++( int )
+      {
+        Iterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+      bool operator==( const Iterator & other ) const
+      {
+        return myIndex == other.myIndex;
+      }
+
+      bool operator!=( const Iterator & other ) const
+      {
+        return myIndex != other.myIndex;
+      }
+
+    private:
+      CellHashTable* myTable;
+      Size myIndex;
+      friend class ConstIterator;
+      friend class CellHashTable;
+    };
+
+    /**
+       Forward iterator on the entries of the table (read-only).
+    */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Entry value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Entry* pointer;
+      typedef const Entry& reference;
+
+      ConstIterator()
+        : myTable( 0 ), myIndex( 0 )
+      {}
+
+      ConstIterator( const CellHashTable* aTable, const Size index )
+        : myTable( aTable ), myIndex( index )
+      {}
+
+      ConstIterator( const Iterator & other )
+        : myTable( other.myTable ), myIndex( other.myIndex )
+      {}
+
+      const Entry & operator*() const
+      {
+        return myTable->myEntries[ myIndex ];
+      }
+
+      const Entry* operator->() const
+      {
+        return &( myTable->myEntries[ myIndex ] );
+      }
+
+      ConstIterator & operator++()
+      {
+        myIndex = myTable->nextUsed( myIndex + 1 );
+        return *this;
+      }
+
+      ConstIterator operator++( int )
+      {
+        ConstIterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+      bool operator==( const ConstIterator & other ) const
+      {
+        return myIndex == other.myIndex;
+      }
+
+      bool operator!=( const ConstIterator & other ) const
+      {
+        return myIndex != other.myIndex;
+      }
+
+    private:
+      const CellHashTable* myTable;
+      Size myIndex;
+    };
+
+    friend class Iterator;
+    friend class ConstIterator;
+
+    // STL-like types.
+    typedef Entry value_type;
+    typedef Iterator iterator;
+    typedef ConstIterator const_iterator;
+    typedef Size size_type;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Creates an empty table.
+     * @param aKSpace the space of the cells (its bounds give the keys).
+     * @param capacity the number of entries that can be stored
+     * without growing.
+     */
+    CellHashTable( const KSpace & aKSpace, const Size capacity = 16 );
+
+    /**
+     * Destructor.
+     */
+    ~CellHashTable();
+
+    /**
+     * @return the hash function.
+     */
+    const Hash & hash() const;
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    /**
+     * @return the number of entries.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff there is no entry.
+     */
+    bool empty() const;
+
+    /**
+     * @return the number of entries that can be stored without growing.
+     */
+    Size capacity() const;
+
+    /**
+     * Removes all the entries (the capacity is kept).
+     */
+    void clear();
+
+    /**
+     * Makes room for @a n entries.
+     * @param n the expected number of entries.
+     */
+    void reserve( const Size n );
+
+    /**
+     * Inserts an entry if its cell is not already in the table.
+     * @param e any entry.
+     * @return an iterator on the entry of the cell and 'true' iff it
+     * has been inserted.
+     */
+    std::pair<Iterator, bool> insert( const Entry & e );
+
+    /**
+     * Inserts a range of entries.
+     * @param first the first entry.
+     * @param last after the last entry.
+     */
+    template <typename EntryInputIterator>
+    void insert( EntryInputIterator first, EntryInputIterator last );
+
+    /**
+     * Removes the entry of a cell.
+     * @param c any cell.
+     * @return the number of removed entries (0 or 1).
+     */
+    Size erase( const Cell & c );
+
+    /**
+     * Removes an entry.
+     * @param it a valid iterator on an entry of this table.
+     */
+    void erase( Iterator it );
+
+    /**
+     * @param c any cell.
+     * @return an iterator on the entry of [c], or end().
+     */
+    Iterator find( const Cell & c );
+
+    /**
+     * @param c any cell.
+     * @return an iterator on the entry of [c], or end().
+     */
+    ConstIterator find( const Cell & c ) const;
+
+    /**
+     * @param c any cell.
+     * @return the number of entries of [c] (0 or 1).
+     */
+    Size count( const Cell & c ) const;
+
+    Iterator begin();
+    Iterator end();
+    ConstIterator begin() const;
+    ConstIterator end() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /// The hash function.
+    Hash myHash;
+    /// The key of each slot (emptyKey() for a free slot).
+    std::vector<Key> myKeys;
+    /// The entry of each slot.
+    std::vector<Entry> myEntries;
+    /// The number of entries.
+    Size mySize;
+    /// The base 2 logarithm of the number of slots.
+    unsigned int myLogSlots;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * @return the key of a free slot (never returned by keyOf).
+     */
+    static Key emptyKey();
+
+    /**
+     * @param c any cell.
+     * @return its key, different from emptyKey().
+     */
+    Key keyOf( const Cell & c ) const;
+
+    /**
+     * @param k any key.
+     * @return the first slot of the probe sequence of [k].
+     */
+    Size homeSlot( const Key k ) const;
+
+    /**
+     * @param c any cell.
+     * @param k its key.
+     * @return the slot of [c], or the number of slots if absent.
+     */
+    Size findSlot( const Cell & c, const Key k ) const;
+
+    /**
+     * @param i any slot index.
+     * @return the first used slot from [i], or the number of slots.
+     */
+    Size nextUsed( Size i ) const;
+
+    /**
+     * Removes the entry of slot [i] and shifts back the entries of
+     * its probe sequence.
+     */
+    void eraseSlot( Size i );
+
+    /**
+     * Moves all the entries into 2^logSlots slots.
+     */
+    void rehash( const unsigned int logSlots );
+
+  }; // end of class CellHashTable
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CellHashSet
+  /**
+     Description of template class 'CellHashSet' <p> \brief Aim: Set
+     of cells (or signed cells) of a cellular grid space, based on an
+     open addressing hash table (see CellHashTable). It may replace a
+     std::set<SCell> in the surface trackers of Surfaces, since it has
+     the same insert/find/erase/clear services, but the iteration
+     order is arbitrary.
+
+     @code
+     CellHashSet<KSpace> surface( K );
+     Surfaces<KSpace>::trackBoundary( surface, K, SAdj, pp, bel );
+     @endcode
+
+     @tparam TKSpace the type of cellular grid space (e.g. a
+     KhalimskySpaceND).
+     @tparam TCell either TKSpace::SCell (default) or TKSpace::Cell.
+
+     @see testCellHashSet.cpp
+   */
+  template < typename TKSpace,
+             typename TCell = typename TKSpace::SCell >
+  class CellHashSet
+    : public CellHashTable< TKSpace, TCell, detail::CellHashSetEntry<TCell> >
+  {
+  public:
+    typedef CellHashTable< TKSpace, TCell, detail::CellHashSetEntry<TCell> > Base;
+    typedef typename Base::KSpace KSpace;
+    typedef typename Base::Size Size;
+
+    /**
+     * Constructor. Creates an empty set.
+     * @param aKSpace the space of the cells.
+     * @param capacity the number of cells that can be stored
+     * without growing.
+     */
+    CellHashSet( const KSpace & aKSpace, const Size capacity = 16 )
+      : Base( aKSpace, capacity )
+    {}
+
+  }; // end of class CellHashSet
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CellHashMap
+  /**
+     Description of template class 'CellHashMap' <p> \brief Aim: Map
+     from the cells (or signed cells) of a cellular grid space to
+     values, based on an open addressing hash table (see
+     CellHashTable). Entries are pairs (cell, value), like in a
+     std::map; the cell of an entry must not be modified.
+
+     @tparam TKSpace the type of cellular grid space (e.g. a
+     KhalimskySpaceND).
+     @tparam TValue the type of the values (default constructible).
+     @tparam TCell either TKSpace::SCell (default) or TKSpace::Cell.
+
+     @see testCellHashSet.cpp
+   */
+  template < typename TKSpace, typename TValue,
+             typename TCell = typename TKSpace::SCell >
+  class CellHashMap
+    : public CellHashTable< TKSpace, TCell, detail::CellHashMapEntry<TCell, TValue> >
+  {
+  public:
+    typedef CellHashTable< TKSpace, TCell,
+                           detail::CellHashMapEntry<TCell, TValue> > Base;
+    typedef typename Base::KSpace KSpace;
+    typedef typename Base::Size Size;
+    typedef typename Base::Entry Entry;
+    typedef TValue Value;
+
+    /**
+     * Constructor. Creates an empty map.
+     * @param aKSpace the space of the cells.
+     * @param capacity the number of entries that can be stored
+     * without growing.
+     */
+    CellHashMap( const KSpace & aKSpace, const Size capacity = 16 )
+      : Base( aKSpace, capacity )
+    {}
+
+    /**
+     * @param c any cell.
+     * @return a reference on the value of [c], inserted with the
+     * default value if [c] was not in the map.
+     */
+    Value & operator[]( const TCell & c )
+    {
+      return this->insert( Entry( c, Value() ) ).first->second;
+    }
+
+  }; // end of class CellHashMap
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CellHashTable'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CellHashTable' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace, typename TCell, typename TEntryTraits>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const CellHashTable<TKSpace, TCell, TEntryTraits> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/CellHashSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CellHashSet_h
+
+#undef CellHashSet_RECURSES
+#endif // else defined(CellHashSet_RECURSES)
@@ -0,0 +1,267 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConnectedComponentLabelling.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/10
+ *
+ * Header file for module ConnectedComponentLabelling.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConnectedComponentLabelling_RECURSES)
+#error Recursive header files inclusion detected in ConnectedComponentLabelling.h
+#else // defined(ConnectedComponentLabelling_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConnectedComponentLabelling_RECURSES
+
+#if !defined ConnectedComponentLabelling_h
+/** Prevents repeated inclusion of headers. */
+#define ConnectedComponentLabelling_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/CImageContainer.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConnectedComponentLabelling
+  /**
+   * Description of template class 'ConnectedComponentLabelling' <p>
+   * \brief Aim: Labels the connected components of an image, a
+   * component being a maximal connected set of points with the same
+   * value.
+   *
+   * The connectivity is the one of MetricAdjacency: two points are
+   * adjacent if their coordinates differ by at most 1 and if their
+   * l1 distance is lower or equal to @a maxNorm1 (in 2D, 1 gives the
+   * 4-connectivity and 2 the 8-connectivity; in 3D, 1, 2 and 3 give
+   * the 6-, 18- and 26-connectivities).
+   *
+   * The points are processed in the linearized order of the domain
+   * (first dimension first) with a flat array union-find on linear
+   * indices (the root of a set is its smallest index, path halving):
+   * each point is merged with its already visited neighbours having
+   * the same value. A last pass numbers the roots in scan order, so
+   * the labels go from 0 to nbComponents()-1 in the order of the
+   * first point of each component.
+   *
+   * If DGtal is built with OpenMP (WITH_OPENMP), the union step can
+   * be run on several threads (see setNumberOfThreads): the domain is
+   * cut into slabs along the last dimension, each slab is processed
+   * independently and the equivalences between adjacent slabs are
+   * merged afterwards. The labels are the same as with one thread.
+   *
+   * If the image is an ImageContainerBySTLVector, its values are read
+   * directly in its buffer, otherwise they are first copied in scan
+   * order. Up to 2^32-1 points are supported.
+   *
+   * @code
+   * typedef ConnectedComponentLabelling<Image> CCL;
+   * CCL ccl( 3 ); // 26-connectivity
+   * CCL::LabelImage labels = ccl.compute( image );
+   * trace.info() << ccl.nbComponents() << " components" << std::endl;
+   * @endcode
+   *
+   * @tparam TImage a model of CImageContainer defined on a
+   * HyperRectDomain (values should be comparable with ==).
+   *
+   * @see testConnectedComponentLabelling.cpp
+   */
+  template <typename TImage>
+  class ConnectedComponentLabelling
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    BOOST_CONCEPT_ASSERT(( CImageContainer<TImage> ));
+
+    typedef TImage Image;
+    typedef typename Image::Value Value;
+    typedef typename Image::Domain Domain;
+    typedef typename Domain::Space Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::Size Size;
+    typedef typename Space::Dimension Dimension;
+
+    /// Type of the labels (and of the linear indices).
+    typedef DGtal::uint32_t Label;
+
+    /// Type of the label image.
+    typedef ImageContainerBySTLVector<HyperRectDomain<Space>, Label> LabelImage;
+
+    /**
+     * Constructor.
+     *
+     * @param maxNorm1 the maximal l1 norm of the displacement between
+     * two adjacent points (between 1 and the dimension).
+     */
+    ConnectedComponentLabelling( const Dimension maxNorm1 = 1 );
+
+    /**
+     * Destructor.
+     */
+    ~ConnectedComponentLabelling();
+
+    /**
+     * Set the number of threads used by the union step (default: 1).
+     * This parameter is ignored if DGtal has not been built with
+     * OpenMP.
+     *
+     * @param nbThreads the number of threads (0 means the OpenMP
+     * default, i.e. usually the number of cores).
+     */
+    void setNumberOfThreads( const unsigned int nbThreads );
+
+    /**
+     * @return the number of threads used by the union step.
+     */
+    unsigned int numberOfThreads() const;
+
+    /**
+     * Labels the connected components of an image.
+     *
+     * @param aImage the input image.
+     * @return the label image (same domain as @a aImage).
+     */
+    LabelImage compute( const Image & aImage );
+
+    /**
+     * @return the number of components found by the last call to
+     * compute.
+     */
+    Label nbComponents() const;
+
+    /**
+     * @return the number of points of each component (indexed by
+     * label) found by the last call to compute.
+     */
+    const std::vector<Size> & componentSizes() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Computes the displacements to the neighbours which are visited
+     * before a point in the scan order.
+     */
+    void computeOffsets();
+
+    /**
+     * @return the root of the set of @a i (with path halving).
+     */
+    inline Label find( Label i );
+
+    /**
+     * Merges the sets of @a i and @a j (the smallest root becomes the
+     * root of the union).
+     */
+    inline void unite( const Label i, const Label j );
+
+    /**
+     * Merges each point of the slab [@a firstSlice, @a lastSlice[
+     * (along the last dimension) with its previously visited
+     * neighbours having the same value.
+     *
+     * @param values the values in scan order.
+     * @param firstSlice first slice of the slab.
+     * @param lastSlice slice after the last slice of the slab.
+     * @param minSlice neighbours on slices before @a minSlice are
+     * ignored.
+     */
+    void uniteSlab( const Value * values, const long int firstSlice,
+                    const long int lastSlice, const long int minSlice );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Maximal l1 norm of the displacements to the neighbours.
+    Dimension myMaxNorm1;
+
+    /// Number of threads (0 = OpenMP default).
+    unsigned int myNbThreads;
+
+    /// Displacements to the previously visited neighbours.
+    std::vector<Point> myOffsets;
+
+    /// Linear index offsets of myOffsets (negative).
+    std::vector<long int> myLinearOffsets;
+
+    /// Extent of the domain of the current image.
+    Point myExtent;
+
+    /// Union-find forest on linear indices.
+    std::vector<Label> myParents;
+
+    /// Sizes of the components.
+    std::vector<Size> mySizes;
+
+  }; // end of class ConnectedComponentLabelling
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ConnectedComponentLabelling'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ConnectedComponentLabelling' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename T>
+  std::ostream&
+  operator<< ( std::ostream & out, const ConnectedComponentLabelling<T> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/ConnectedComponentLabelling.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConnectedComponentLabelling_h
+
+#undef ConnectedComponentLabelling_RECURSES
+#endif // else defined(ConnectedComponentLabelling_RECURSES)
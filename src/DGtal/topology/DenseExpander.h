@@ -0,0 +1,321 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DenseExpander.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/06/01
+ *
+ * Header file for module DenseExpander.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DenseExpander_RECURSES)
+#error Recursive header files inclusion detected in DenseExpander.h
+#else // defined(DenseExpander_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DenseExpander_RECURSES
+
+#if !defined DenseExpander_h
+/** Prevents repeated inclusion of headers. */
+#define DenseExpander_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/NeighborhoodOffsets.h"
+#include "DGtal/topology/MetricAdjacency.h"
+#include "DGtal/topology/DomainAdjacency.h"
+#include "DGtal/topology/Object.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DenseExpander
+  /**
+   * Description of template class 'DenseExpander' <p> \brief Aim:
+   * Visits an object lying in a bounded HyperRectDomain by
+   * adjacencies, layer by layer, like Expander, but with arrays
+   * indexed by the linearized points of the domain instead of sets.
+   *
+   * The points of the object, of the core and of the current layer
+   * are flagged in an array of bytes covering the domain of the
+   * object, and each layer is a vector of points (and of their
+   * linear indices). The neighbors of a point are then visited with
+   * constant index shifts, so that each layer costs a time linear in
+   * its size and in the size of the previous layer, without any
+   * lookup or insertion in a set. The memory is linear in the size of
+   * the domain, which should therefore be bounded and not too large
+   * with respect to the object.
+   *
+   * The layers and distances are the same as the ones of Expander
+   * for the same object and the same initial core, but the points of
+   * a layer are given in the order of their discovery, not in the
+   * order of a DigitalSet.
+   *
+   * The foreground adjacency of the object must be a MetricAdjacency,
+   * possibly restricted by a DomainAdjacency to a domain containing
+   * the object.
+   *
+   * @tparam TObject the type of the digital object, whose domain is a
+   * HyperRectDomain.
+   *
+   * @code
+   * typedef DenseExpander< ObjectType > ObjectExpander;
+   * ObjectExpander expander( object, p );
+   * while ( ! expander.finished() )
+   *   {
+   *     for ( ObjectExpander::ConstIterator it = expander.begin();
+   *           it != expander.end(); ++it )
+   *        process( *it, expander.distance() );
+   *     expander.nextLayer();
+   *   }
+   * @endcode
+   *
+   * @see Expander
+   * @see testDenseExpander.cpp
+   * @see testExpander-benchmark.cpp
+   */
+  template <typename TObject>
+  class DenseExpander
+  {
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef TObject Object;
+    typedef typename Object::Size Size;
+    typedef typename Object::Point Point;
+    typedef typename Object::Domain Domain;
+    typedef typename Object::DigitalSet DigitalSet;
+    typedef typename Object::ForegroundAdjacency ForegroundAdjacency;
+    typedef typename Domain::Space Space;
+    typedef typename Space::Vector Vector;
+    typedef typename AdjacencyOffsetsSelector<ForegroundAdjacency>::Type
+    Offsets;
+    typedef typename std::vector<Point>::const_iterator ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DenseExpander();
+
+    /**
+     * Constructor from a point. This point provides the initial core
+     * of the expander.
+     *
+     * @param object the digital object in which the expander expands.
+     * @param p any point in the given object.
+     */
+    DenseExpander( const Object & object, const Point & p );
+
+    /**
+     * Constructor from iterators. All points visited between the
+     * iterators should be distinct two by two and lie in the domain
+     * of the object. The so specified set of points provides the
+     * initial core of the expander.
+     *
+     * @tparam the type of an InputIterator pointing on a Point.
+     *
+     * @param object the digital object in which the expander expands.
+     * @param b the begin point in a set.
+     * @param e the end point in a set.
+     */
+    template <typename PointInputIterator>
+    DenseExpander( const Object & object,
+                   PointInputIterator b, PointInputIterator e );
+
+    // ----------------------- Expansion services ------------------------------
+  public:
+
+    /**
+     * @return 'true' if all possible elements have been visited.
+     */
+    bool finished() const;
+
+    /**
+     * @return the current distance to the initial core, or
+     * equivalently the index of the current layer.
+     */
+    Size distance() const;
+
+    /**
+     * Extract next layer. You might used begin() and end() to access
+     * all the elements of the new layer.
+     *
+     * @return 'true' if there was another layer, or 'false' if it was the
+     * last (ie. reverse of finished() ).
+     */
+    bool nextLayer();
+
+    /**
+     * @param p any point of the domain of the object.
+     * @return 'true' iff [p] belongs to the (current) core.
+     */
+    bool inCore( const Point & p ) const;
+
+    /**
+     * @return the number of points of the (current) core.
+     */
+    Size coreSize() const;
+
+    /**
+     * @return a const reference on the (current) layer of points.
+     */
+    const std::vector<Point> & layer() const;
+
+    /**
+     * @return the iterator on the first element of the layer.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return the iterator after the last element of the layer.
+     */
+    ConstIterator end() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Flags of the points of the domain.
+    enum Flags { IN_OBJECT = 1, IN_CORE = 2, IN_LAYER = 4 };
+
+    /// Lowest point of the domain.
+    Point myLower;
+
+    /// Highest point of the domain.
+    Point myUpper;
+
+    /// Extent of the domain.
+    Vector myExtent;
+
+    /// The flags of the points of the domain.
+    std::vector<unsigned char> myFlags;
+
+    /// Index shifts of the neighbors, in the order of Offsets.
+    std::vector<long int> myLinearOffsets;
+
+    /// Points of the current layer.
+    std::vector<Point> myLayer;
+
+    /// Linear indices of the points of the current layer.
+    std::vector<long int> myLayerIndices;
+
+    /// Number of points of the core.
+    Size myCoreSize;
+
+    /// Current distance to origin.
+    Size myDistance;
+
+    /// Boolean stating whether the expansion is over or not.
+    bool myFinished;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Fills the flags with the points of @a object.
+     * @param object the digital object in which the expander expands.
+     */
+    void init( const Object & object );
+
+    /**
+     * Adds a point to the initial core.
+     * @param p any point of the domain.
+     * @param points the points of the core.
+     * @param indices their linear indices.
+     */
+    void addToCore( const Point & p, std::vector<Point> & points,
+                    std::vector<long int> & indices );
+
+    /**
+     * @param p any point of the domain.
+     * @return its linear index.
+     */
+    long int index( const Point & p ) const;
+
+    /**
+     * Push the layer into the current core. Must be called before
+     * computeNextLayer.
+     */
+    void endLayer();
+
+    /**
+     * Computes the next layer just around the given points, which
+     * must belong to the core. The current layer is replaced only if
+     * the new one is not empty.
+     *
+     * @param points the points around which the new layer is computed.
+     * @param indices their linear indices.
+     */
+    void computeNextLayer( const std::vector<Point> & points,
+                           const std::vector<long int> & indices );
+
+    DenseExpander ( const DenseExpander & other );
+    DenseExpander & operator= ( const DenseExpander & other );
+
+  }; // end of class DenseExpander
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DenseExpander'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DenseExpander' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TObject>
+  std::ostream&
+  operator<< ( std::ostream & out, const DenseExpander<TObject> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/DenseExpander.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DenseExpander_h
+
+#undef DenseExpander_RECURSES
+#endif // else defined(DenseExpander_RECURSES)
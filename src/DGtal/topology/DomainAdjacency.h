@@ -45,6 +45,7 @@
 #include "DGtal/kernel/domains/CDomain.h"
 #include "DGtal/kernel/domains/DomainPredicate.h"
 #include "DGtal/topology/CAdjacency.h"
+#include "DGtal/topology/NeighborhoodOffsets.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -281,6 +282,12 @@ namespace DGtal
   operator<< ( std::ostream & out, 
          const DomainAdjacency<TDomain, TAdjacency> & object );
 
+  /// The restriction to a domain keeps the displacements.
+  template <typename TDomain, typename TAdjacency>
+  struct AdjacencyOffsetsSelector< DomainAdjacency<TDomain, TAdjacency> >
+    : public AdjacencyOffsetsSelector<TAdjacency>
+  {};
+
 } // namespace DGtal
 
 
@@ -0,0 +1,392 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HomotopicThinning.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/05/30
+ *
+ * Header file for module HomotopicThinning.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HomotopicThinning_RECURSES)
+#error Recursive header files inclusion detected in HomotopicThinning.h
+#else // defined(HomotopicThinning_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HomotopicThinning_RECURSES
+
+#if !defined HomotopicThinning_h
+/** Prevents repeated inclusion of headers. */
+#define HomotopicThinning_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/topology/NeighborhoodOffsets.h"
+#include "DGtal/topology/SimplePointTable.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class HomotopicThinning
+  /**
+   * Description of template class 'HomotopicThinning' <p> \brief
+   * Aim: Removes simple points from an object until none can be
+   * removed, which preserves its topology (homotopic thinning). The
+   * result is a skeleton of the object, or the object reduced to a
+   * point per component if it has no holes and no constraints.
+   *
+   * The object is copied in a dense array of flags covering its
+   * bounding box (plus a margin of one point), so that the
+   * configuration of the neighbors of a point is read with constant
+   * index shifts and answered by a SimplePointTable. Hence the
+   * digital topology of the object must be a Jordan couple of metric
+   * adjacencies in 2D or 3D (see SimplePointTableSelector).
+   *
+   * Two kinds of points are never removed:
+   *
+   * - anchors, given with addAnchor or addAnchors,
+   *
+   * - end points, if setPreserveEndPoints(true) was called, i.e. the
+   *   points with exactly one kappa-neighbor in the object. The
+   *   branches of the skeleton are then kept (curve skeleton).
+   *
+   * The points are removed in one of the following orders:
+   *
+   * - by layers (thin(object)): the border points of the object are
+   *   tested first, then the points uncovered by their removal, and
+   *   so on, like a peeling of the object,
+   *
+   * - by priorities (thin(object, priorities)): the candidate with
+   *   the smallest priority is tested first, for instance with the
+   *   distance map computed by DistanceTransformation, which gives a
+   *   skeleton close to the medial axis.
+   *
+   * In both cases, a point which is not removable is tested again
+   * each time one of its neighbors is removed.
+   *
+   * If the number of threads is not 1 (see setNumberOfThreads), the
+   * thinning by layers uses subfields instead: the points are split
+   * into 2^n subfields according to the parity of their coordinates.
+   * Two points of the same subfield are never adjacent, so that all
+   * the removable points of a subfield can be detected concurrently
+   * (with OpenMP threads if DGtal is built WITH_OPENMP) and removed at
+   * once. The subfields are processed one after the other until
+   * stability. The result depends only on whether this mode is
+   * chosen, not on the actual number of threads.
+   *
+   * @code
+   * Object6_26 shape( dt6_26, shape_set );
+   * HomotopicThinning<Object6_26> thinning;
+   * thinning.setPreserveEndPoints( true );
+   * thinning.thin( shape );  // shape is now a curve skeleton.
+   * @endcode
+   *
+   * @tparam TObject any Object whose topology has a SimplePointTable.
+   *
+   * @see testHomotopicThinning.cpp
+   * @see homotopicThinning3D.cpp
+   */
+  template <typename TObject>
+  class HomotopicThinning
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    typedef TObject Object;
+    typedef typename Object::DigitalTopology DigitalTopology;
+    typedef typename Object::DigitalSet DigitalSet;
+    typedef typename Object::Space Space;
+    typedef typename Object::Point Point;
+    typedef typename Object::Size Size;
+    typedef typename Space::Vector Vector;
+
+    BOOST_STATIC_ASSERT(( SimplePointTableSelector<DigitalTopology>
+                          ::Supported::value ));
+
+    /// The table answering the simplicity of the points.
+    typedef typename SimplePointTableSelector<DigitalTopology>::Type Table;
+    typedef typename Table::Configuration Configuration;
+
+    /**
+     * Constructor.
+     *
+     * @param preserveEndPoints when 'true', end points are never
+     * removed.
+     */
+    HomotopicThinning( const bool preserveEndPoints = false );
+
+    /**
+     * Destructor.
+     */
+    ~HomotopicThinning();
+
+    /**
+     * @param preserveEndPoints when 'true', end points (points with
+     * exactly one kappa-neighbor in the object) are never removed.
+     */
+    void setPreserveEndPoints( const bool preserveEndPoints );
+
+    /**
+     * @return 'true' if end points are never removed.
+     */
+    bool preserveEndPoints() const;
+
+    /**
+     * Set the number of threads (default: 1). Any other value than 1
+     * selects the subfield scheme for the thinning by layers. The
+     * number of threads is ignored if DGtal has not been built with
+     * OpenMP.
+     *
+     * @param nbThreads the number of threads (0 means the OpenMP
+     * default, i.e. usually the number of cores).
+     */
+    void setNumberOfThreads( const unsigned int nbThreads );
+
+    /**
+     * @return the number of threads.
+     */
+    unsigned int numberOfThreads() const;
+
+    /**
+     * Adds a point that is never removed.
+     * @param p any point.
+     */
+    void addAnchor( const Point & p );
+
+    /**
+     * Adds points that are never removed.
+     *
+     * @tparam PointIterator any iterator on points.
+     * @param itb an iterator on the first point.
+     * @param ite an iterator after the last point.
+     */
+    template <typename PointIterator>
+    void addAnchors( PointIterator itb, PointIterator ite );
+
+    /**
+     * Removes all the anchors.
+     */
+    void clearAnchors();
+
+    /**
+     * @return the anchors.
+     */
+    const std::vector<Point> & anchors() const;
+
+    /**
+     * Thinning by layers (or by subfields if the number of threads is
+     * not 1). The removed points are erased from the point set of @a
+     * object.
+     *
+     * @param object the object to thin.
+     * @return the number of removed points.
+     */
+    Size thin( Object & object );
+
+    /**
+     * Thinning by priorities (always sequential): the candidate with
+     * the smallest priority is tested first, the ties being broken by
+     * the order of insertion in the queue. The removed points are
+     * erased from the point set of @a object.
+     *
+     * @tparam TImage any image whose values are convertible to
+     * double, like the output of DistanceTransformation, defined at
+     * least on the points of the object.
+     *
+     * @param object the object to thin.
+     * @param priorities the priority of each point.
+     * @return the number of removed points.
+     */
+    template <typename TImage>
+    Size thin( Object & object, const TImage & priorities );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Flags of the points of the dense array.
+    enum Flags { IN_OBJECT = 1, ANCHOR = 2, QUEUED = 4 };
+
+    /// When 'true', end points are never removed.
+    bool myPreserveEndPoints;
+
+    /// Number of threads (0 = OpenMP default).
+    unsigned int myNbThreads;
+
+    /// Points never removed.
+    std::vector<Point> myAnchors;
+
+    /// Lowest point of the dense array.
+    Point myLower;
+
+    /// Extent of the dense array.
+    Vector myExtent;
+
+    /// The flags of the points of the bounding box of the object.
+    std::vector<unsigned char> myFlags;
+
+    /// Index shifts of the neighbors, in the order of the table.
+    std::vector<long int> myLinearOffsets;
+
+    /// Bits of the kappa-neighbors in a configuration.
+    Configuration myKappaNeighbors;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// Priority of the layers: one more than the removed neighbor.
+    struct LayerPriority
+    {
+      double operator()( const Point & p, const double parent ) const;
+    };
+
+    /// Priority read in an image.
+    template <typename TImage>
+    struct ImagePriority
+    {
+      ImagePriority( const TImage & image );
+      double operator()( const Point & p, const double parent ) const;
+      const TImage & myImage;
+    };
+
+    /// An element of the priority queue.
+    struct Candidate
+    {
+      double priority;
+      Size order;
+      long int index;
+      bool operator<( const Candidate & other ) const;
+    };
+
+    /**
+     * Fills the dense array with the points of @a object and its
+     * anchors.
+     * @param object any object.
+     */
+    void init( const Object & object );
+
+    /**
+     * @param p any point of the dense array.
+     * @return its index.
+     */
+    long int index( const Point & p ) const;
+
+    /**
+     * @param index any index of the dense array.
+     * @return its point.
+     */
+    Point point( long int index ) const;
+
+    /**
+     * @param index any index of the dense array (not on its border).
+     * @return the configuration of its neighbors.
+     */
+    Configuration configuration( const long int index ) const;
+
+    /**
+     * @param index any index of a point of the object.
+     * @return 'true' iff the point may be removed.
+     */
+    bool isRemovable( const long int index ) const;
+
+    /**
+     * @param index any index of a point of the object.
+     * @return 'true' iff the point has a neighbor in the complement.
+     */
+    bool isBorder( const long int index ) const;
+
+    /**
+     * Sequential thinning ordered by a priority functor.
+     *
+     * @param object the object to thin.
+     * @param priority gives the priority of a point, knowing the one
+     * of the removed neighbor that uncovered it (or -1).
+     * @return the number of removed points.
+     */
+    template <typename PriorityFunctor>
+    Size thinSequential( Object & object, const PriorityFunctor & priority );
+
+    /**
+     * Thinning by subfields.
+     * @param object the object to thin.
+     * @return the number of removed points.
+     */
+    Size thinSubfields( Object & object );
+
+    /**
+     * Erases the points whose flag IN_OBJECT is cleared from @a object.
+     * @param object the thinned object.
+     * @param removed the indices of the removed points.
+     */
+    void erase( Object & object, const std::vector<long int> & removed ) const;
+
+    HomotopicThinning ( const HomotopicThinning & other );
+    HomotopicThinning & operator= ( const HomotopicThinning & other );
+
+  }; // end of class HomotopicThinning
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'HomotopicThinning'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'HomotopicThinning' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TObject>
+  std::ostream&
+  operator<< ( std::ostream & out, const HomotopicThinning<TObject> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/HomotopicThinning.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HomotopicThinning_h
+
+#undef HomotopicThinning_RECURSES
+#endif // else defined(HomotopicThinning_RECURSES)
@@ -0,0 +1,223 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file KhalimskyCellHash.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/05/16
+ *
+ * Header file for module KhalimskyCellHash.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(KhalimskyCellHash_RECURSES)
+#error Recursive header files inclusion detected in KhalimskyCellHash.h
+#else // defined(KhalimskyCellHash_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define KhalimskyCellHash_RECURSES
+
+#if !defined KhalimskyCellHash_h
+/** Prevents repeated inclusion of headers. */
+#define KhalimskyCellHash_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KhalimskyCellHash
+  /**
+     Description of template class 'KhalimskyCellHash' <p> \brief
+     Aim: Hash function for the cells (KhalimskyCell) and signed cells
+     (SignedKhalimskyCell) of a given cellular grid space.
+
+     The Khalimsky coordinates of a cell of the space K lie between
+     2*K.min(k) and 2*K.max(k)+2 along each axis k. When the number
+     of bits needed to store all of them, plus one for the sign of a
+     signed cell, is at most 63, the key of a cell is the
+     concatenation of these shifted coordinates (and of its sign): two
+     different cells of the space have then different keys. Otherwise
+     (e.g. for the default unbounded space), the key mixes the
+     coordinates and is only a hash value.
+
+     The key of a cell outside the bounds of the space is still a
+     valid hash value, so that containers should always compare cells
+     whose keys are equal (see CellHashSet).
+
+     @code
+     KhalimskyCellHash<KSpace> hash( K );
+     DGtal::uint64_t k = hash.key( K.sSpel( p ) );
+     @endcode
+
+     @tparam TKSpace the type of cellular grid space (e.g. a
+     KhalimskySpaceND).
+
+     @see CellHashSet
+     @see testCellHashSet.cpp
+   */
+  template <typename TKSpace>
+  class KhalimskyCellHash
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Cell Cell;
+    typedef typename KSpace::SCell SCell;
+    typedef DGtal::uint64_t Key;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aKSpace the space whose bounds define the packing.
+     */
+    KhalimskyCellHash( const KSpace & aKSpace );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    KhalimskyCellHash( const KhalimskyCellHash & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    KhalimskyCellHash & operator= ( const KhalimskyCellHash & other );
+
+    /**
+     * Destructor.
+     */
+    ~KhalimskyCellHash();
+
+    // ----------------------- Hash services ------------------------------
+  public:
+
+    /**
+     * @return 'true' iff the keys of two different cells (or signed
+     * cells) of the space are different.
+     */
+    bool isPacked() const;
+
+    /**
+     * @param c any cell.
+     * @return its key (the packed coordinates if isPacked()).
+     */
+    Key key( const Cell & c ) const;
+
+    /**
+     * @param c any signed cell.
+     * @return its key (the packed coordinates and sign if isPacked()).
+     */
+    Key key( const SCell & c ) const;
+
+    /**
+     * @param c any cell.
+     * @return a hash value, whose bits are all significant.
+     */
+    std::size_t operator()( const Cell & c ) const;
+
+    /**
+     * @param c any signed cell.
+     * @return a hash value, whose bits are all significant.
+     */
+    std::size_t operator()( const SCell & c ) const;
+
+    /**
+     * Spreads the bits of a key (multiplicative hashing).
+     * @param k any key.
+     * @return a value whose high bits depend on all the bits of k.
+     */
+    static Key mix( Key k );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Lowest Khalimsky coordinate along each axis.
+    Integer myOrigin[ KSpace::dimension ];
+    /// Position of the bits of each coordinate in a key (sign first).
+    unsigned int myShifts[ KSpace::dimension ];
+    /// 'true' iff all the coordinates fit in a key.
+    bool myPacked;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    KhalimskyCellHash();
+
+    /**
+     * @param coords the Khalimsky coordinates of a cell.
+     * @return the key of the coordinates, starting at bit 1.
+     */
+    template <typename TPoint>
+    Key coordinatesKey( const TPoint & coords ) const;
+
+  }; // end of class KhalimskyCellHash
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'KhalimskyCellHash'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'KhalimskyCellHash' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const KhalimskyCellHash<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/KhalimskyCellHash.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined KhalimskyCellHash_h
+
+#undef KhalimskyCellHash_RECURSES
+#endif // else defined(KhalimskyCellHash_RECURSES)
@@ -45,6 +45,7 @@
 #include "DGtal/kernel/CSpace.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/topology/NeighborhoodOffsets.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -70,6 +71,11 @@ namespace DGtal
    * less or equal than 1 and if their norm-1 is less or equal than
    * maxNorm1.
    *
+   * The neighborhoods are enumerated with the precomputed table of
+   * displacements NeighborhoodOffsets (see the Offsets type), which
+   * also provides the linear index shifts of the neighbors for the
+   * algorithms working on dense images.
+   *
    * @see testAdjacency.cpp
    */
   template <typename TSpace, Dimension maxNorm1, 
@@ -87,6 +93,9 @@ namespace DGtal
     // Others
     typedef typename Space::Vector Vector;
 
+    /// Table of the displacements to the proper neighbors.
+    typedef NeighborhoodOffsets<Space, maxNorm1> Offsets;
+
     // ----------------------- Standard services ------------------------------
   public:
 
@@ -255,6 +264,14 @@ namespace DGtal
          const MetricAdjacency< TSpace,maxNorm1,
          TSpace::dimension > & object );
 
+  template <typename TSpace, Dimension maxNorm1, Dimension dimension>
+  struct AdjacencyOffsetsSelector
+  < MetricAdjacency<TSpace, maxNorm1, dimension> >
+  {
+    typedef boost::true_type Supported;
+    typedef NeighborhoodOffsets<TSpace, maxNorm1> Type;
+  };
+
 } // namespace DGtal
 
 
@@ -0,0 +1,272 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file NeighborhoodOffsets.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/05/11
+ *
+ * Header file for module NeighborhoodOffsets.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(NeighborhoodOffsets_RECURSES)
+#error Recursive header files inclusion detected in NeighborhoodOffsets.h
+#else // defined(NeighborhoodOffsets_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define NeighborhoodOffsets_RECURSES
+
+#if !defined NeighborhoodOffsets_h
+/** Prevents repeated inclusion of headers. */
+#define NeighborhoodOffsets_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <boost/type_traits.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CSpace.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+    /**
+     * Number of displacements of {-1,0,1}^dim (null one included)
+     * whose norm-1 is less or equal than maxNorm1, computed at
+     * compile time with N(d,m) = N(d-1,m) + 2 N(d-1,m-1).
+     */
+    template <Dimension dim, Dimension maxNorm1>
+    struct NeighborhoodCount
+    {
+      static const unsigned int value =
+        NeighborhoodCount<dim - 1, maxNorm1>::value
+        + 2 * NeighborhoodCount<dim - 1, maxNorm1 - 1>::value;
+    };
+
+    template <Dimension dim>
+    struct NeighborhoodCount<dim, 0>
+    {
+      static const unsigned int value = 1;
+    };
+
+    template <Dimension maxNorm1>
+    struct NeighborhoodCount<0, maxNorm1>
+    {
+      static const unsigned int value = 1;
+    };
+
+    template <>
+    struct NeighborhoodCount<0, 0>
+    {
+      static const unsigned int value = 1;
+    };
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class NeighborhoodOffsets
+  /**
+   * Description of template class 'NeighborhoodOffsets' <p> \brief
+   * Aim: Table of the displacements from a point to its proper
+   * neighbors for the metric adjacencies (see MetricAdjacency), and
+   * their linearized counterparts for dense images.
+   *
+   * The displacements are the vectors v of {-1,0,1}^n with 0 <
+   * norm1(v) <= maxNorm1. Their number (e.g. 6, 18 or 26 in 3D) is
+   * the compile time constant \a size and the table is computed only
+   * once, at the first use. They are sorted in the order of a
+   * HyperRectDomain iteration of [-1,1]^n (first coordinate first),
+   * so that the table is symmetric: the opposite of offset(i) is
+   * offset(size-1-i), and the null displacement would lie between
+   * offset(size/2-1) and offset(size/2).
+   *
+   * For an image stored in a linearized array (first coordinate
+   * first, like ImageContainerBySTLVector), writeLinearOffsets gives
+   * the index shifts of the displacements and writeLinearNeighborhood
+   * enumerates the indices of the neighbors of a point lying in the
+   * image domain, whose points are linearized by linearIndex.
+   *
+   * @code
+   * typedef NeighborhoodOffsets<Z3i::Space, 2> Offsets18;
+   * for ( const Z3i::Vector* it = Offsets18::begin();
+   *       it != Offsets18::end(); ++it )
+   *   process( p + *it );
+   * @endcode
+   *
+   * @tparam TSpace any digital space (see concept CSpace).
+   *
+   * @tparam maxNorm1 the maximal norm-1 of the displacements.
+   *
+   * @see MetricAdjacency
+   * @see testAdjacency.cpp
+   */
+  template <typename TSpace, Dimension maxNorm1>
+  class NeighborhoodOffsets
+  {
+    BOOST_CONCEPT_ASSERT(( CSpace<TSpace> ));
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TSpace Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::Vector Vector;
+
+    /// Number of proper neighbors.
+    static const unsigned int size =
+      detail::NeighborhoodCount<Space::dimension, maxNorm1>::value - 1;
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+     * @return a pointer to the first displacement of the table.
+     */
+    static const Vector* begin();
+
+    /**
+     * @return a pointer after the last displacement of the table.
+     */
+    static const Vector* end();
+
+    /**
+     * @param i an index smaller than size.
+     * @return the i-th displacement.
+     */
+    static const Vector & offset( const unsigned int i );
+
+    /**
+     * Outputs the index shifts of the displacements in an array
+     * whose first coordinate varies first.
+     *
+     * @tparam OutputIterator any output iterator on integers (like
+     * long int*).
+     *
+     * @param extent the extent of the array along each dimension.
+     * @param out_it any output iterator.
+     */
+    template <typename OutputIterator>
+    static
+    void writeLinearOffsets( const Vector & extent,
+                             OutputIterator & out_it );
+
+    /**
+     * @param p any point of an array whose first coordinate varies
+     * first.
+     * @param lower the lowest point of the array.
+     * @param extent the extent of the array along each dimension.
+     * @return the linear index of [p] in the array.
+     */
+    static
+    long int linearIndex( const Point & p, const Point & lower,
+                          const Vector & extent );
+
+    /**
+     * Outputs the linear indices of the neighbors of point [p]
+     * (except p itself) which lie in the domain [lower,upper] as a
+     * sequence of *out_it++ = ...
+     *
+     * @tparam OutputIterator any output iterator on integers.
+     *
+     * @param p any point of the domain.
+     * @param index the linear index of p.
+     * @param lower the lower bound of the domain.
+     * @param upper the upper bound of the domain.
+     * @param linearOffsets the index shifts given by writeLinearOffsets
+     * for the extent of the domain.
+     * @param out_it any output iterator.
+     */
+    template <typename OutputIterator>
+    static
+    void writeLinearNeighborhood( const Point & p, const long int index,
+                                  const Point & lower, const Point & upper,
+                                  const long int* linearOffsets,
+                                  OutputIterator & out_it );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    static
+    void selfDisplay ( std::ostream & out );
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    static
+    bool isValid();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// The table, filled by its constructor.
+    struct Table
+    {
+      Table();
+      Vector offsets[ size ];
+    };
+
+    /**
+     * @return the table (built at the first call).
+     */
+    static const Table & table();
+
+    NeighborhoodOffsets();
+    NeighborhoodOffsets ( const NeighborhoodOffsets & other );
+    NeighborhoodOffsets & operator= ( const NeighborhoodOffsets & other );
+
+  }; // end of class NeighborhoodOffsets
+
+  /**
+   * Aim: Gives the NeighborhoodOffsets of an adjacency, for the
+   * algorithms working on dense images. \a Supported is
+   * boost::true_type and \a Type the table of displacements for
+   * metric adjacencies (see MetricAdjacency), possibly restricted to
+   * a domain (see DomainAdjacency), and \a Supported is
+   * boost::false_type otherwise.
+   *
+   * @tparam TAdjacency any model of CAdjacency.
+   */
+  template <typename TAdjacency>
+  struct AdjacencyOffsetsSelector
+  {
+    typedef boost::false_type Supported;
+    typedef void Type;
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/NeighborhoodOffsets.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined NeighborhoodOffsets_h
+
+#undef NeighborhoodOffsets_RECURSES
+#endif // else defined(NeighborhoodOffsets_RECURSES)
@@ -42,10 +42,13 @@
 // Inclusions
 #include <iostream>
 #include <string>
+#include <boost/type_traits.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CowPtr.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/topology/NeighborhoodOffsets.h"
 //////////////////////////////////////////////////////////////////////////////
 
 
@@ -74,6 +77,12 @@ namespace DGtal
    * points which touch the complement in the sense of background
    * adjacency.
    *
+   * When the domain is a HyperRectDomain and the adjacencies are
+   * metric (see AdjacencyOffsetsSelector), the border and the
+   * connected components are computed on a dense array covering the
+   * bounding box of the object, in time linear in its size, provided
+   * the object is not too sparse in this box (see DENSE_RATIO).
+   *
    * \b export: An Object realizes the concept CDrawableWithBoard2D. It
    * may be displayed with a Board2D, and is by default displayed
    * as a set of digital points. An Object reacts to the mode
@@ -329,6 +338,10 @@ namespace DGtal
        * which is lambda()-adjacent with some point of the background).
        *
        * NB : the background adjacency should be a symmetric relation.
+       *
+       * For a metric background adjacency in a HyperRectDomain, the
+       * neighbors are read in a dense array with constant index
+       * shifts instead of being searched in the point set.
        */
       Object border() const;
 
@@ -372,6 +385,12 @@ namespace DGtal
          It is nearly as efficient (the clone uses smart copy on write
          pointers) and works in any case. You might even overwrite your
          object while doing this.
+
+         For a metric foreground adjacency in a HyperRectDomain, the
+         components are labelled by a union-find on a dense array,
+         in one raster scan, instead of one Expander per component.
+         The components are written in the same order, i.e. the
+         order of their first point in the point set.
        */
       template <typename OutputObjectIterator>
       Size writeComponents( OutputObjectIterator & it ) const;
@@ -428,6 +447,12 @@ namespace DGtal
        * careful, such a definition is valid only for Jordan couples in
        * dimension 2 and 3.
        *
+       * For the Jordan couples of metric adjacencies in 2D and 3D
+       * (see SimplePointTableSelector), the neighbors of a point of
+       * the object are encoded as a bitmask and the answer is given
+       * by a SimplePointTable, without computing any geodesic
+       * neighborhood.
+       *
        * @return 'true' if this point is simple.
        */
       bool isSimple( const Point & v ) const;
@@ -472,6 +497,84 @@ namespace DGtal
 
     private:
 
+      /**
+       * Tells if the dense algorithms apply for the adjacency
+       * TAdjacency: \a Type is boost::true_type iff the domain is a
+       * HyperRectDomain and TAdjacency is metric.
+       */
+      template <typename TAdjacency>
+      struct DenseSelector
+      {
+        typedef boost::integral_constant
+        < bool,
+          boost::is_same< Domain, HyperRectDomain<Space> >::value
+          && AdjacencyOffsetsSelector<TAdjacency>::Supported::value > Type;
+      };
+
+      /**
+       * Border computed with the point set.
+       * @return the border of this object.
+       */
+      Object border( boost::false_type ) const;
+
+      /**
+       * Border computed on a dense array.
+       * @return the border of this object.
+       */
+      Object border( boost::true_type ) const;
+
+      /**
+       * Components computed with one Expander per component.
+       * @param it the output iterator. *it is an Object.
+       * @return the number of components.
+       */
+      template <typename OutputObjectIterator>
+      Size writeComponents( OutputObjectIterator & it,
+                            boost::false_type ) const;
+
+      /**
+       * Components computed by a union-find on a dense array.
+       * @param it the output iterator. *it is an Object.
+       * @return the number of components.
+       */
+      template <typename OutputObjectIterator>
+      Size writeComponents( OutputObjectIterator & it,
+                            boost::true_type ) const;
+
+      /**
+       * The dense algorithms are used only if the bounding box of the
+       * object has at most DENSE_RATIO times as many points as the
+       * object, so that their memory stays linear in its size.
+       */
+      static const std::size_t DENSE_RATIO = 8;
+
+      /**
+       * Bounding box of the (non empty) object, with a margin of one
+       * point, for the dense algorithms.
+       *
+       * @param lower (returns) the lowest point of the box.
+       * @param extent (returns) the extent of the box.
+       * @return the number of points of the box, or 0 if the object is
+       * too sparse in it (see DENSE_RATIO) or if the box cannot be
+       * indexed with 32 bits.
+       */
+      std::size_t denseBox( Point & lower,
+                            typename Space::Vector & extent ) const;
+
+      /**
+       * Simplicity test with a SimplePointTable.
+       * @param v any point.
+       * @return 'true' if this point is simple.
+       */
+      bool isSimple( const Point & v, boost::true_type ) const;
+
+      /**
+       * Simplicity test with the geodesic neighborhoods.
+       * @param v any point.
+       * @return 'true' if this point is simple.
+       */
+      bool isSimple( const Point & v, boost::false_type ) const;
+
       /**
        * Default style.
        */
@@ -0,0 +1,305 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SimplePointTable.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/05/27
+ *
+ * Header file for module SimplePointTable.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SimplePointTable_RECURSES)
+#error Recursive header files inclusion detected in SimplePointTable.h
+#else // defined(SimplePointTable_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SimplePointTable_RECURSES
+
+#if !defined SimplePointTable_h
+/** Prevents repeated inclusion of headers. */
+#define SimplePointTable_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/type_traits.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/NeighborhoodOffsets.h"
+#include "DGtal/topology/MetricAdjacency.h"
+#include "DGtal/topology/DigitalTopology.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SimplePointTable
+  /**
+   * Description of template class 'SimplePointTable' <p> \brief Aim:
+   * Answers whether a point is simple from the configuration of its
+   * 3^n-1 neighbors, for the (kappa,lambda) digital topology whose
+   * adjacencies are the metric adjacencies of norm-1 \a kappaNorm and
+   * \a lambdaNorm (e.g. (1,2) is the (4,8) topology in 2D and (1,3)
+   * the (6,26) topology in 3D).
+   *
+   * A configuration is a bitmask: its bit i is set iff the point p +
+   * NeighborhoodOffsets<Space,dim>::offset(i) belongs to the object
+   * (the neighbors are thus sorted as in a HyperRectDomain iteration
+   * of [-1,1]^n). The point p itself is assumed to be in the object.
+   *
+   * The simplicity of a configuration is computed with the same
+   * geodesic neighborhoods as Object::isSimple, but on bitmasks of
+   * the 3^n cube (no set is allocated). Moreover, the answers may be
+   * stored in a table of 2^(3^n-1) bits:
+   *
+   * - in 2D, the table (256 bits) is computed at the first use,
+   *
+   * - in 3D, the table (2^26 bits, i.e. 8MB) is computed only on
+   *   demand with computeTable() (tens of seconds on one core, shared
+   *   among the OpenMP threads if any), or loaded from a
+   *   file written by saveTable(). Without table, each configuration
+   *   is computed on the fly.
+   *
+   * computeTable() and loadTable() must not be called while other
+   * threads are using the table.
+   *
+   * Such a definition of simple points is valid only for Jordan
+   * couples in dimension 2 and 3, hence only these topologies are
+   * selected by SimplePointTableSelector, which is used by
+   * Object::isSimple.
+   *
+   * @tparam dim the dimension of the space (2 or 3).
+   * @tparam kappaNorm the maximal norm-1 of the foreground adjacency.
+   * @tparam lambdaNorm the maximal norm-1 of the background adjacency.
+   *
+   * @see Object::isSimple
+   * @see testSimplePointTable.cpp
+   */
+  template <Dimension dim, Dimension kappaNorm, Dimension lambdaNorm>
+  class SimplePointTable
+  {
+    // ----------------------- public types ------------------------------
+  public:
+
+    /// A configuration of the neighbors of a point (one bit per neighbor).
+    typedef DGtal::uint32_t Configuration;
+
+    /// Number of neighbors of a point (3^n-1).
+    static const unsigned int size =
+      detail::NeighborhoodCount<dim, dim>::value - 1;
+
+    /// Number of configurations.
+    static const DGtal::uint64_t nbConfigurations =
+      ( (DGtal::uint64_t) 1 ) << size;
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+     * @param c any configuration of the neighbors of a point of the
+     * object.
+     *
+     * @return 'true' iff this point is simple. Uses the table if it
+     * is computed, otherwise calls computeIsSimple.
+     */
+    static bool isSimple( const Configuration c );
+
+    /**
+     * Computes the simplicity of a configuration without the table.
+     *
+     * @param c any configuration of the neighbors of a point of the
+     * object.
+     *
+     * @return 'true' iff this point is simple.
+     */
+    static bool computeIsSimple( const Configuration c );
+
+    /**
+     * @return 'true' iff the table is available.
+     */
+    static bool hasTable();
+
+    /**
+     * Computes the whole table (uses OpenMP threads if available).
+     */
+    static void computeTable();
+
+    /**
+     * Loads the table from a file written by saveTable.
+     *
+     * @param filename the name of the file.
+     * @return 'true' if the table was read, 'false' otherwise (the
+     * table is then unchanged).
+     */
+    static bool loadTable( const std::string & filename );
+
+    /**
+     * Writes the table (computed if necessary) in a binary file.
+     *
+     * @param filename the name of the file.
+     * @return 'true' if no errors occur.
+     */
+    static bool saveTable( const std::string & filename );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    static
+    void selfDisplay ( std::ostream & out );
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    static
+    bool isValid();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Number of points of the cube [-1,1]^n.
+    static const unsigned int cubeSize = size + 1;
+    /// Index of the center of the cube.
+    static const unsigned int center = size / 2;
+
+    /**
+     * The adjacencies within the cube [-1,1]^n, whose points are
+     * numbered as in a HyperRectDomain iteration (first coordinate
+     * first), computed once.
+     */
+    struct Adjacencies
+    {
+      Adjacencies();
+      /// kappa[ j ] is the set of the points kappa-adjacent to j.
+      Configuration kappa[ cubeSize ];
+      /// lambda[ j ] is the set of the points lambda-adjacent to j.
+      Configuration lambda[ cubeSize ];
+    };
+
+    /// The table of the simple configurations (one bit each).
+    struct Table
+    {
+      Table();
+      /// Empty, or nbConfigurations/8 bytes.
+      std::vector<unsigned char> bits;
+    };
+
+    /**
+     * @return the adjacencies (built at the first call).
+     */
+    static const Adjacencies & adjacencies();
+
+    /**
+     * @return the table (computed at the first call in 2D, empty in
+     * 3D until computeTable or loadTable).
+     */
+    static Table & table();
+
+    /**
+     * Fills [bits] with the simplicity of all the configurations.
+     * @param bits a vector of nbConfigurations/8 bytes.
+     */
+    static void fill( std::vector<unsigned char> & bits );
+
+    /**
+     * @param core a set of points of the cube.
+     * @param domain a set of points of the cube.
+     * @param adj an adjacency within the cube.
+     * @param n the number of dilations.
+     *
+     * @return the set of the points of [domain] whose geodesic
+     * distance to [core] (within [domain]) is at most [n].
+     */
+    static Configuration dilate( Configuration core,
+                                 const Configuration domain,
+                                 const Configuration* adj,
+                                 unsigned int n );
+
+    /**
+     * @param set a non empty set of points of the cube.
+     * @param adj an adjacency within the cube.
+     * @return 'true' iff [set] is connected for [adj].
+     */
+    static bool isConnected( const Configuration set,
+                             const Configuration* adj );
+
+    SimplePointTable();
+    SimplePointTable ( const SimplePointTable & other );
+    SimplePointTable & operator= ( const SimplePointTable & other );
+
+  }; // end of class SimplePointTable
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SimplePointTableSelector
+  /**
+   * Description of template class 'SimplePointTableSelector' <p>
+   * \brief Aim: Selects the SimplePointTable of a digital topology,
+   * if any. \a Supported is boost::true_type only for the Jordan
+   * couples of metric adjacencies, i.e. (4,8) and (8,4) in 2D, and
+   * (6,18), (18,6), (6,26) and (26,6) in 3D, and \a Type is then the
+   * corresponding SimplePointTable.
+   *
+   * @tparam TDigitalTopology any digital topology.
+   */
+  template <typename TDigitalTopology>
+  struct SimplePointTableSelector
+  {
+    typedef boost::false_type Supported;
+    typedef void Type;
+  };
+
+  template <typename TSpace, Dimension kappaNorm, Dimension lambdaNorm,
+            Dimension dim>
+  struct SimplePointTableSelector
+  < DigitalTopology< MetricAdjacency<TSpace, kappaNorm, dim>,
+                     MetricAdjacency<TSpace, lambdaNorm, dim> > >
+  {
+    typedef boost::integral_constant
+    < bool,
+      ( ( dim == 2 ) || ( dim == 3 ) )
+      && ( ( kappaNorm == 1 ) || ( lambdaNorm == 1 ) )
+      && ( kappaNorm != lambdaNorm )
+      && ( kappaNorm <= dim ) && ( lambdaNorm <= dim ) > Supported;
+    typedef SimplePointTable<dim, kappaNorm, lambdaNorm> Type;
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SimplePointTable.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SimplePointTable_h
+
+#undef SimplePointTable_RECURSES
+#endif // else defined(SimplePointTable_RECURSES)
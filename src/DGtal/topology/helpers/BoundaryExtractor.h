@@ -0,0 +1,337 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BoundaryExtractor.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/05/13
+ *
+ * Header file for module BoundaryExtractor.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BoundaryExtractor_RECURSES)
+#error Recursive header files inclusion detected in BoundaryExtractor.h
+#else // defined(BoundaryExtractor_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BoundaryExtractor_RECURSES
+
+#if !defined BoundaryExtractor_h
+/** Prevents repeated inclusion of headers. */
+#define BoundaryExtractor_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BoundaryExtractor
+  /**
+     Description of template class 'BoundaryExtractor' <p> \brief Aim:
+     Extracts all the boundary surfels of a digital shape within the
+     bounds of a cellular grid space, grouped by connected components
+     (for a given surfel adjacency), without any tree-based set.
+
+     The shape, given by a point predicate, is scanned slice by slice
+     along the last axis, so that only two slices of point values are
+     kept. The surfels separating two points of the space with
+     different values are emitted in a flat array, in scan order,
+     together with a union-find forest on their indices. Each surfel
+     adjacency is local to a 2x2 square of points in a plane of two
+     axes (the "followers" of SurfelNeighborhood), hence all the
+     squares of the current slices are visited once and the surfels
+     they link are merged. Surfels are found from their position with
+     two slices of surfel indices. The memory is thus proportional to
+     the number of surfels plus a few slices, instead of the tree
+     nodes of a std::set<SCell>.
+
+     At the end, the surfels are reordered so that each connected
+     surface is a contiguous range of surfels(), the components
+     being sorted by their first surfel in scan order.
+
+     The surfels are the ones built by Surfaces::sMakeBoundary (same
+     orientation) and the components are the ones obtained by
+     Surfaces::trackBoundary, provided the surfel adjacency is
+     symmetric (getAdjacency(i,j) == getAdjacency(j,i), which is the
+     case of the usual interior or exterior adjacencies).
+
+     @code
+     BoundaryExtractor<KSpace> extractor( K, SurfelAdjacency<3>( true ) );
+     extractor.extract( SetPredicate<DigitalSet>( aSet ) );
+     for ( unsigned int c = 0; c < extractor.nbComponents(); ++c )
+       process( extractor.componentBegin( c ), extractor.componentEnd( c ) );
+     @endcode
+
+     @tparam TKSpace the type of cellular grid space (e.g. a
+     KhalimskySpaceND).
+
+     @see Surfaces::extractAllConnectedSCell
+     @see testCellularGridSpaceND.cpp
+   */
+  template <typename TKSpace>
+  class BoundaryExtractor
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::Size Size;
+    typedef DGtal::uint32_t Index;
+    typedef typename std::vector<SCell>::const_iterator ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aKSpace the space (its bounds define the scanned box).
+     * @param aSurfelAdj the surfel adjacency (should be symmetric).
+     */
+    BoundaryExtractor( const KSpace & aKSpace,
+                       const SurfelAdjacency<KSpace::dimension> & aSurfelAdj );
+
+    /**
+     * Destructor.
+     */
+    ~BoundaryExtractor();
+
+    /**
+     * @param aSurfelAdj any surfel adjacency.
+     * @return 'true' iff getAdjacency(i,j) == getAdjacency(j,i) for
+     * all directions, i.e. the components computed by this class
+     * are the ones of Surfaces::trackBoundary.
+     */
+    static bool isSymmetric
+    ( const SurfelAdjacency<KSpace::dimension> & aSurfelAdj );
+
+    /**
+     * Extracts the boundary of the shape defined by @a pp.
+     *
+     * @tparam PointPredicate a model of CPointPredicate describing
+     * the inside of a digital shape.
+     *
+     * @param pp the predicate, evaluated once for each point of the
+     * space.
+     */
+    template <typename PointPredicate>
+    void extract( const PointPredicate & pp );
+
+    /**
+     * @return the number of surfels of the last extraction.
+     */
+    Size nbSurfels() const;
+
+    /**
+     * @return the number of connected surfaces of the last extraction.
+     */
+    Size nbComponents() const;
+
+    /**
+     * @return all the surfels, the ones of a connected surface being
+     * contiguous.
+     */
+    const std::vector<SCell> & surfels() const;
+
+    /**
+     * @param c a component index (less than nbComponents()).
+     * @return an iterator on the first surfel of the component.
+     */
+    ConstIterator componentBegin( const Size c ) const;
+
+    /**
+     * @param c a component index (less than nbComponents()).
+     * @return an iterator after the last surfel of the component.
+     */
+    ConstIterator componentEnd( const Size c ) const;
+
+    /**
+     * Copies each connected surface in its own vector.
+     * @param aVectConnectedSCell (modified) the vector of surfaces.
+     */
+    void writeComponents
+    ( std::vector< std::vector<SCell> > & aVectConnectedSCell ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Index of a missing surfel.
+    static const Index NoSurfel = 0xFFFFFFFF;
+
+    /// The space.
+    const KSpace & myKSpace;
+    /// The surfel adjacency.
+    const SurfelAdjacency<KSpace::dimension> & mySurfelAdj;
+
+    /// Extent of the space along each axis.
+    Point myExtent;
+    /// Number of points of a slice.
+    Size mySliceSize;
+    /// Index shifts along each axis in a slice.
+    Size myStrides[ KSpace::dimension ];
+
+    /// The surfels (in scan order, then grouped by component).
+    std::vector<SCell> mySurfels;
+    /// Union-find forest on the surfel indices.
+    std::vector<Index> myParents;
+    /// First surfel of each component (plus the total number).
+    std::vector<Size> myComponentStarts;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    BoundaryExtractor();
+    BoundaryExtractor ( const BoundaryExtractor & other );
+    BoundaryExtractor & operator= ( const BoundaryExtractor & other );
+
+    /**
+     * @return the root of the set of @a i (with path halving).
+     */
+    Index find( Index i );
+
+    /**
+     * Merges the sets of @a i and @a j.
+     */
+    void unite( const Index i, const Index j );
+
+    /**
+     * Moves to the next point of a slice (first coordinate first).
+     * @param q (modified) coordinates relative to the lower bound.
+     */
+    void nextInSlice( Point & q ) const;
+
+    /**
+     * Evaluates the predicate on the slice @a z.
+     * @param pp the predicate.
+     * @param z the slice (relative to the lower bound).
+     * @param values (modified) the values of the points of the slice.
+     */
+    template <typename PointPredicate>
+    void loadSlice( const PointPredicate & pp, const Integer z,
+                    std::vector<char> & values ) const;
+
+    /**
+     * Creates the surfels between the points of the slice @a z.
+     * @param z the slice (relative to the lower bound).
+     * @param values the values of the points of the slice.
+     * @param ids (modified) the surfel index between q and q+e_k
+     * is ids[k*sliceSize+index(q)].
+     */
+    void makeSliceSurfels( const Integer z, const std::vector<char> & values,
+                           std::vector<Index> & ids );
+
+    /**
+     * Creates the surfels between the slices @a z and @a z+1.
+     * @param z the slice (relative to the lower bound).
+     * @param values the values of the points of the slice z.
+     * @param nextValues the values of the points of the slice z+1.
+     * @param ids (modified) the surfel index between q and q+e_d
+     * is ids[index(q)].
+     */
+    void makeCrossSurfels( const Integer z, const std::vector<char> & values,
+                           const std::vector<char> & nextValues,
+                           std::vector<Index> & ids );
+
+    /**
+     * Merges the surfels of the squares lying in a slice.
+     */
+    void uniteSlice( const std::vector<char> & values,
+                     const std::vector<Index> & ids );
+
+    /**
+     * Merges the surfels of the squares lying between two slices.
+     */
+    void uniteCross( const std::vector<char> & values,
+                     const std::vector<char> & nextValues,
+                     const std::vector<Index> & ids,
+                     const std::vector<Index> & nextIds,
+                     const std::vector<Index> & crossIds );
+
+    /**
+     * Merges the surfels of a 2x2 square of points of the plane of
+     * axes (@a j, @a k), @a j < @a k, following the surfel adjacency.
+     *
+     * @param in the values of the points (j,k) = (0,0), (1,0), (0,1)
+     * and (1,1).
+     * @param edges the surfels between the points 0-1, 2-3 (orthogonal
+     * to j) and 0-2, 1-3 (orthogonal to k), NoSurfel if the two points
+     * have the same value.
+     * @param j the first axis.
+     * @param k the second axis.
+     */
+    void uniteSquare( const bool in[ 4 ], const Index edges[ 4 ],
+                      const Dimension j, const Dimension k );
+
+    /**
+     * Groups the surfels by component (counting sort on the roots).
+     */
+    void groupComponents();
+
+  }; // end of class BoundaryExtractor
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BoundaryExtractor'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BoundaryExtractor' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const BoundaryExtractor<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/helpers/BoundaryExtractor.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BoundaryExtractor_h
+
+#undef BoundaryExtractor_RECURSES
+#endif // else defined(BoundaryExtractor_RECURSES)
@@ -0,0 +1,297 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ParallelSurfaceTracker.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/05/17
+ *
+ * Header file for module ParallelSurfaceTracker.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ParallelSurfaceTracker_RECURSES)
+#error Recursive header files inclusion detected in ParallelSurfaceTracker.h
+#else // defined(ParallelSurfaceTracker_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ParallelSurfaceTracker_RECURSES
+
+#if !defined ParallelSurfaceTracker_h
+/** Prevents repeated inclusion of headers. */
+#define ParallelSurfaceTracker_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/topology/CellHashSet.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ParallelSurfaceTracker
+  /**
+     Description of template class 'ParallelSurfaceTracker' <p>
+     \brief Aim: Multithreaded counterparts of the surface tracking
+     of Surfaces::trackBoundary, for one very large surface or for
+     many surfaces given by seeds.
+
+     trackBoundary() is a breadth-first traversal by levels: the
+     followers of all the surfels of the current level (which need
+     the predicate evaluations) are computed in parallel while the
+     surface is only read, then they are inserted in the surface by
+     one thread to form the next level.
+
+     trackBoundaries() tracks the surfaces of a sequence of seeds. The
+     seeds are distributed among the threads, each one tracking its
+     seeds by a serial traversal. A surfel belongs to the first seed
+     which reaches it, thanks to a visited set shared by all the
+     threads, cut into stripes each protected by a lock. When a
+     traversal meets a surfel of another seed, both seeds are
+     recorded to lie on the same surface, so that each surface is
+     tracked once whatever the number of seeds lying on it.
+
+     Without OpenMP (WITH_OPENMP), or with one thread, the same
+     computations are done serially. In all cases, the surfels are
+     the ones given by Surfaces::trackBoundary.
+
+     @code
+     ParallelSurfaceTracker<KSpace> tracker( K, SAdj );
+     tracker.setNumberOfThreads( 0 );
+     std::vector< std::vector<SCell> > surfaces;
+     tracker.trackBoundaries( surfaces, pp, seeds );
+     @endcode
+
+     @tparam TKSpace the type of cellular grid space (e.g. a
+     KhalimskySpaceND).
+
+     @see Surfaces::trackBoundary
+     @see testParallelSurfaceTracker.cpp
+   */
+  template <typename TKSpace>
+  class ParallelSurfaceTracker
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::SCell SCell;
+    typedef SurfelAdjacency<KSpace::dimension> SurfelAdj;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aKSpace the space.
+     * @param aSurfelAdj the surfel adjacency chosen for the tracking.
+     */
+    ParallelSurfaceTracker( const KSpace & aKSpace,
+                            const SurfelAdj & aSurfelAdj );
+
+    /**
+     * Destructor.
+     */
+    ~ParallelSurfaceTracker();
+
+    /**
+     * Set the number of threads (default: 1). This parameter is
+     * ignored if DGtal has not been built with OpenMP.
+     *
+     * @param nbThreads the number of threads (0 means the OpenMP
+     * default, i.e. usually the number of cores).
+     */
+    void setNumberOfThreads( const unsigned int nbThreads );
+
+    /**
+     * @return the number of threads.
+     */
+    unsigned int numberOfThreads() const;
+
+    // ----------------------- Tracking services ------------------------------
+  public:
+
+    /**
+     * Creates the set of signed surfels of the boundary component of
+     * the shape [pp] which touches [start_surfel], by a traversal by
+     * levels whose followers are computed in parallel.
+     *
+     * @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>
+     * or CellHashSet<KSpace>) whose const services can be called
+     * concurrently.
+     *
+     * @tparam PointPredicate a model of CPointPredicate, which may be
+     * evaluated concurrently.
+     *
+     * @param surface (modified) the surfels of the boundary component.
+     * @param pp the predicate describing the shape.
+     * @param start_surfel a signed surfel between an element of the
+     * shape and an element not in the shape.
+     */
+    template <typename SCellSet, typename PointPredicate>
+    void trackBoundary( SCellSet & surface,
+                        const PointPredicate & pp,
+                        const SCell & start_surfel ) const;
+
+    /**
+     * Tracks the boundary components of the shape [pp] touching a
+     * sequence of seeds. There is one surface per component, in the
+     * order of the first seed lying on it, and its surfels are sorted
+     * (as in a std::set<SCell>). This is the result of calling
+     * Surfaces::trackBoundary on each seed which does not lie on an
+     * already tracked surface.
+     *
+     * NB: the surfel adjacency should be symmetric (see
+     * BoundaryExtractor::isSymmetric), otherwise the seeds are
+     * processed serially.
+     *
+     * @tparam PointPredicate a model of CPointPredicate, which may be
+     * evaluated concurrently.
+     *
+     * @param surfaces (modified) the surfels of each component.
+     * @param pp the predicate describing the shape.
+     * @param seeds signed surfels between an element of the shape and
+     * an element not in the shape.
+     */
+    template <typename PointPredicate>
+    void trackBoundaries( std::vector< std::vector<SCell> > & surfaces,
+                          const PointPredicate & pp,
+                          const std::vector<SCell> & seeds ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Visited set shared by threads: each surfel is mapped to the
+       seed which reached it first. The map is cut into stripes
+       (chosen from the hashed key of the surfel), each one protected
+       by its own lock.
+    */
+    class ClaimTable
+    {
+    public:
+      typedef CellHashMap<KSpace, unsigned int> Stripe;
+
+      ClaimTable( const KSpace & aKSpace, const unsigned int nbStripes );
+      ~ClaimTable();
+
+      /**
+       * Maps [c] to [seed] if it is not mapped yet.
+       * @param c any surfel.
+       * @param seed the index of the claiming seed.
+       * @param inserted (modified) 'true' iff [c] was not mapped.
+       * @return the seed of [c].
+       */
+      unsigned int claim( const SCell & c, const unsigned int seed,
+                          bool & inserted );
+
+      /// The stripes of the map.
+      std::vector<Stripe> stripes;
+
+    private:
+      KhalimskyCellHash<KSpace> myHash;
+#ifdef WITH_OPENMP
+      std::vector<omp_lock_t> myLocks;
+#endif
+      ClaimTable( const ClaimTable & other );
+      ClaimTable & operator=( const ClaimTable & other );
+    };
+
+    /**
+     * Outputs the followers of the surfel [b] along all its tracking
+     * directions.
+     */
+    template <typename PointPredicate>
+    void followers( SurfelNeighborhood<KSpace> & SN,
+                    const PointPredicate & pp, const SCell & b,
+                    std::vector<SCell> & out ) const;
+
+    /**
+     * @return the number of threads to use.
+     */
+    int effectiveNumberOfThreads() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The space.
+    const KSpace & myKSpace;
+    /// The surfel adjacency.
+    const SurfelAdj & mySurfelAdj;
+    /// The number of threads (0 for the OpenMP default).
+    unsigned int myNbThreads;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    ParallelSurfaceTracker();
+    ParallelSurfaceTracker ( const ParallelSurfaceTracker & other );
+    ParallelSurfaceTracker & operator= ( const ParallelSurfaceTracker & other );
+
+  }; // end of class ParallelSurfaceTracker
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ParallelSurfaceTracker'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ParallelSurfaceTracker' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const ParallelSurfaceTracker<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/helpers/ParallelSurfaceTracker.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ParallelSurfaceTracker_h
+
+#undef ParallelSurfaceTracker_RECURSES
+#endif // else defined(ParallelSurfaceTracker_RECURSES)
@@ -45,6 +45,7 @@
 #include "DGtal/base/Exceptions.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/topology/helpers/BoundaryExtractor.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -148,7 +149,8 @@ namespace DGtal
        PointPredicate. The algorithms tracks surfels along the
        boundary of the shape.
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>,
+       or CellHashSet<KSpace> for constant time insertions).
 
        @tparam PointPredicate a model of CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
@@ -342,6 +344,10 @@ namespace DGtal
        
        @param pp an instance of a model of CPointPredicate, for
        instance a SetPredicate for a digital set representing a shape.
+
+       NB: for a symmetric surfel adjacency, the starting surfels are
+       given by a BoundaryExtractor instead of a set of all the
+       boundary surfels.
     */
     template <typename PointPredicate>
     static 
@@ -378,6 +384,13 @@ namespace DGtal
        default cell orientation in order to get the direction of shape
        exterior (default =false). This is used only for displaying
        cells with Viewer3D. This mechanism should evolve shortly.
+
+       NB: for a symmetric surfel adjacency (the usual interior or
+       exterior ones), the components are computed in one scan of the
+       space by a BoundaryExtractor, otherwise each one is tracked
+       from the set of all boundary surfels. The result is the same:
+       each component is sorted and the components are ordered by
+       their first surfel.
     */
     template <typename PointPredicate >
     static 
@@ -434,7 +447,8 @@ namespace DGtal
        be fully inside the space. Follows the idea of Artzy, Frieder
        and Herman algorithm [Artzy:1981-cgip], but in nD.
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>,
+       or CellHashSet<KSpace> for constant time insertions).
 
        @tparam PointPredicate a model of CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
@@ -467,7 +481,8 @@ namespace DGtal
        boundary components of a digital shape described by the predicate
        [pp].
        
-       @tparam CellSet a model of a set of Cell (e.g., std::set<Cell>).
+       @tparam CellSet a model of a set of Cell (e.g., std::set<Cell>, or
+       CellHashSet<KSpace,Cell> for constant time insertions).
        @tparam PointPredicate a model of CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
        and returning 'true' whenever the point belongs to the shape.
@@ -495,7 +510,8 @@ namespace DGtal
        boundary components of a digital shape described by the predicate
        [pp].
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>,
+       or CellHashSet<KSpace> for constant time insertions).
        @tparam PointPredicate a model of CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
        and returning 'true' whenever the point belongs to the shape.
@@ -0,0 +1,13 @@
+/**
+* @file   ConfigTest.h
+* @author David COEURJOLLY <David Coeurjolly <david.coeurjolly@liris.cnrs.fr>>
+* @date   29 Jul. 2010
+* @brief  Configuration header for test files. 
+*
+**/
+
+#include <string>
+
+///Path to the DGtal test suite.
+const std::string testPath= "/root/repo/tests/";
+
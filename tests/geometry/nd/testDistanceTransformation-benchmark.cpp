@@ -0,0 +1,153 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDistanceTransformation-benchmark.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/02
+ *
+ * Benchmark of the DistanceTransformation with respect to the
+ * tile size and to the number of threads (requires the WITH_OPENMP
+ * option to observe any multithreading speed-up).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <ctime>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageSelector.h"
+#include "DGtal/geometry/nd/volumetric/DistanceTransformation.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Benchmark of the multithreaded DistanceTransformation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Runs the L2 DT of a 3D image made of random background points for
+ * several tile sizes and an increasing number of threads, and checks
+ * that the results are identical to the serial one.
+ *
+ * @param n the size of the cubic image.
+ */
+bool benchmarkDistanceTransformation( const int n )
+{
+  typedef SpaceND<3> TSpace;
+  typedef TSpace::Point Point;
+  typedef HyperRectDomain<TSpace> Domain;
+  typedef ImageSelector<Domain, unsigned int>::Type Image;
+  typedef DistanceTransformation<Image, 2> DT;
+
+  Point a ( 0, 0, 0 );
+  Point b ( n - 1, n - 1, n - 1 );
+  Image image ( a, b );
+
+  trace.beginBlock ( "Creating the image" );
+  srand( 0 );
+  for ( Image::Iterator it = image.begin(), itend = image.end();
+	it != itend; ++it )
+    image.setValue( it, ( rand() % 1000 == 0 ) ? 0 : 128 );
+  trace.endBlock();
+
+  DT dt;
+  trace.beginBlock ( "Serial DT" );
+  DT::OutputImage reference = dt.compute( image );
+  trace.endBlock();
+
+  bool ok = true;
+  for ( unsigned int tileSize = 1; tileSize <= 64; tileSize *= 4 )
+    {
+      dt.setTileSize( tileSize );
+      std::clock_t start = std::clock();
+      DT::OutputImage result = dt.compute( image );
+      double elapsed = ( std::clock() - start ) * 1000.0 / CLOCKS_PER_SEC;
+
+      bool identical = true;
+      for ( DT::OutputImage::ConstIterator it = result.begin(),
+	      itref = reference.begin(), itend = result.end();
+	    it != itend; ++it, ++itref )
+	identical = identical && ( *it == *itref );
+      ok = ok && identical;
+
+      trace.emphase() << n << "^3 tile size " << tileSize << ": "
+		      << elapsed << "ms"
+		      << ( identical ? "" : " DIFFERENT RESULT" ) << endl;
+    }
+  dt.setTileSize( 16 );
+
+#ifdef WITH_OPENMP
+  const unsigned int maxThreads = omp_get_num_procs();
+  double serialTime = 0.0;
+  for ( unsigned int nbThreads = 1; nbThreads <= maxThreads; nbThreads *= 2 )
+    {
+      dt.setNumberOfThreads( nbThreads );
+      double start = omp_get_wtime();
+      DT::OutputImage result = dt.compute( image );
+      double elapsed = omp_get_wtime() - start;
+      if ( nbThreads == 1 )
+	serialTime = elapsed;
+
+      bool identical = true;
+      for ( DT::OutputImage::ConstIterator it = result.begin(),
+	      itref = reference.begin(), itend = result.end();
+	    it != itend; ++it, ++itref )
+	identical = identical && ( *it == *itref );
+      ok = ok && identical;
+
+      trace.emphase() << n << "^3 " << nbThreads << " thread(s): "
+		      << elapsed << "s (speed-up " << serialTime / elapsed << ")"
+		      << ( identical ? "" : " DIFFERENT RESULT" ) << endl;
+    }
+#else
+  trace.warning() << "DGtal built without OpenMP, multithreaded DT not benchmarked."
+		  << endl;
+#endif
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking multithreaded DistanceTransformation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int n = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 128;
+  bool res = benchmarkDistanceTransformation( n );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
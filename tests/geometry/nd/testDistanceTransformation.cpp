@@ -576,6 +576,151 @@ bool testChessboard()
   return nbok == nb;
 }
 
+/**
+ * Checks that the multithreaded DT gives the same result as the
+ * serial one.
+ */
+bool testMultithreadedDT()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing multithreaded 3D DT computation" );
+
+  typedef SpaceND<3> TSpace;
+  typedef TSpace::Point Point;
+  typedef HyperRectDomain<TSpace> Domain;
+  Point a ( 0, 0, 0 );
+  Point b ( 31, 23, 17 );
+  typedef ImageSelector<Domain, unsigned int>::Type Image;
+  Image image ( a, b );
+  for ( Image::Iterator it = image.begin(), itend = image.end();
+	it != itend; ++it )
+    image.setValue( it, 128 );
+  randomSeeds( image, 40, 0 );
+
+  typedef DistanceTransformation<Image, 2> DT;
+  DT dt;
+  DT::OutputImage serial = dt.compute ( image );
+  dt.setNumberOfThreads( 4 );
+  DT::OutputImage parallel = dt.compute ( image );
+
+  bool identical = true;
+  for ( DT::OutputImage::ConstIterator it = serial.begin(),
+	  itp = parallel.begin(), itend = serial.end();
+	it != itend; ++it, ++itp )
+    identical = identical && ( *it == *itp );
+  nbok += identical ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "serial == 4 threads" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Checks that the tiled DT gives the same result as the column by
+ * column one.
+ */
+bool testTiledDT()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing tiled 3D DT computation" );
+
+  typedef SpaceND<3> TSpace;
+  typedef TSpace::Point Point;
+  typedef HyperRectDomain<TSpace> Domain;
+  Point a ( -5, 0, 3 );
+  Point b ( 34, 20, 17 );
+  typedef ImageSelector<Domain, unsigned int>::Type Image;
+  Image image ( a, b );
+  for ( Image::Iterator it = image.begin(), itend = image.end();
+	it != itend; ++it )
+    image.setValue( it, 128 );
+  randomSeeds( image, 40, 0 );
+
+  typedef DistanceTransformation<Image, 2> DT;
+  DT dt;
+  DT::OutputImage tiled = dt.compute ( image );
+  dt.setTileSize( 1 );
+  DT::OutputImage untiled = dt.compute ( image );
+
+  bool identical = true;
+  for ( DT::OutputImage::ConstIterator it = tiled.begin(),
+	  itu = untiled.begin(), itend = tiled.end();
+	it != itend; ++it, ++itu )
+    identical = identical && ( *it == *itu );
+  nbok += identical ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "tiled == untiled" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Checks the Voronoi map: sites are background points and the
+ * distance to the site is the DT value.
+ */
+bool testVoronoiMap()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing 3D Voronoi map computation" );
+
+  typedef SpaceND<3> TSpace;
+  typedef TSpace::Point Point;
+  typedef HyperRectDomain<TSpace> Domain;
+  Point a ( -5, 0, 3 );
+  Point b ( 24, 20, 17 );
+  typedef ImageSelector<Domain, unsigned int>::Type Image;
+  Image image ( a, b );
+  for ( Image::Iterator it = image.begin(), itend = image.end();
+	it != itend; ++it )
+    image.setValue( it, 128 );
+  randomSeeds( image, 30, 0 );
+
+  typedef DistanceTransformation<Image, 2> DT;
+  DT dt;
+  DT::OutputImage result = dt.compute ( image );
+  DT::OutputImage distances ( a, b );
+  DT::VoronoiMap voronoi = dt.computeVoronoiMap ( image, &distances );
+
+  bool sameDistances = true;
+  bool validSites = true;
+  Domain domain ( a, b );
+  for ( Domain::ConstIterator it = domain.begin(), itend = domain.end();
+	it != itend; ++it )
+    {
+      sameDistances = sameDistances && ( result( *it ) == distances( *it ) );
+      Point site = voronoi( *it );
+      Point::Coordinate d = 0;
+      for ( unsigned int k = 0; k < 3; ++k )
+	d += ( site[ k ] - (*it)[ k ] ) * ( site[ k ] - (*it)[ k ] );
+      validSites = validSites && ( image( site ) == 0 ) 
+	&& ( d == result( *it ) );
+    }
+  nbok += sameDistances ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "compute() == computeVoronoiMap() distances" << std::endl;
+  nbok += validSites ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "sites are closest background points" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -592,7 +737,10 @@ int main ( int argc, char** argv )
     && testDistanceTransformationBorder() 
     && testDistanceTransformation3D()
     && testChessboard()
-    && testDTFromSet();
+    && testDTFromSet()
+    && testMultithreadedDT()
+    && testTiledDT()
+    && testVoronoiMap();
   //&& ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
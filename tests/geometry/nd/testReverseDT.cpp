@@ -382,6 +382,70 @@ bool testReverseDTSet()
 
 }
 
+/**
+ * Checks that the tiled reverse DT, serial or parallel, gives the
+ * same result as the column by column one.
+ */
+bool testTiledReverseDT()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing tiled Reverse DT in 3D ..." );
+  
+  Z3i::Point a ( 0, 0, 0 );
+  Z3i::Point b ( 37, 20, 25 );
+
+  typedef ImageSelector< Z3i::Domain,  int>::Type Image;
+  Image image ( a, b );
+  for ( Image::Iterator it = image.begin(), itend = image.end();
+        it != itend; ++it )
+    image.setValue ( it, 128 );
+  randomSeeds( image, 50, 0 );
+
+  DistanceTransformation<Image, 2 > dt;
+  typedef DistanceTransformation<Image,2>::OutputImage ImageDT;
+  ImageDT result = dt.compute ( image );
+  
+  //We only keep a few balls
+  for ( ImageDT::Iterator it = result.begin(), itend = result.end();
+        it != itend; ++it )
+    if ( rand() % 20 != 0 )
+      result.setValue ( it, 0 );
+
+  ReverseDistanceTransformation< ImageDT, 2 > reverseDT;
+  typedef ReverseDistanceTransformation< ImageDT, 2 >::OutputImage ImageRDT;
+  ImageRDT tiled = reverseDT.reconstruction( result );
+  reverseDT.setNumberOfThreads( 4 );
+  ImageRDT parallel = reverseDT.reconstruction( result );
+  reverseDT.setNumberOfThreads( 1 );
+  reverseDT.setTileSize( 1 );
+  ImageRDT untiled = reverseDT.reconstruction( result );
+
+  bool ok = true;
+  for ( ImageRDT::ConstIterator it = tiled.begin(), itu = untiled.begin(), 
+          itend = tiled.end(); it != itend; ++it, ++itu )
+    ok = ok && ( *it == *itu );
+
+  nbok += ok ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "tiled == untiled" << std::endl;
+
+  ok = true;
+  for ( ImageRDT::ConstIterator it = tiled.begin(), itp = parallel.begin(), 
+          itend = tiled.end(); it != itend; ++it, ++itp )
+    ok = ok && ( *it == *itp );
+
+  nbok += ok ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "tiled == parallel tiled" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -394,7 +458,8 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testReverseDT() && testReverseDTSet() 
-    && testReverseDTL1() && testReverseDTL1simple(); // && ... other tests
+    && testReverseDTL1() && testReverseDTL1simple()
+    && testTiledReverseDT(); // && ... other tests
   
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
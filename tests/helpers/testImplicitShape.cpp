@@ -153,6 +153,78 @@ bool testImplicitShape3D()
   return nbok == nb;
 }
 
+/**
+ * @return 'true' iff Shapes::shaper with [nbThreads] threads gives
+ * the same set as the evaluation of every point of the bounding box
+ * of [aShape].
+ */
+template <typename TDigitalSet, typename TShape>
+bool sameAsBruteForce( const TShape & aShape, unsigned int nbThreads )
+{
+  typedef typename TDigitalSet::Domain Domain;
+  Domain domain( aShape.getLowerBound(), aShape.getUpperBound() );
+  TDigitalSet set( domain );
+  TDigitalSet reference( domain );
+  Shapes<Domain>::shaper( set, aShape, nbThreads );
+  for ( typename Domain::ConstIterator it = domain.begin(), 
+    itEnd = domain.end(); it != itEnd; ++it )
+    if ( aShape.isInside( *it ) )
+      reference.insert( *it );
+  trace.info() << "shaper: " << set.size() << " points, expected "
+         << reference.size() << std::endl;
+  if ( set.size() != reference.size() )
+    return false;
+  for ( typename TDigitalSet::ConstIterator it = reference.begin(), 
+    itEnd = reference.end(); it != itEnd; ++it )
+    if ( set.find( *it ) == set.end() )
+      return false;
+  return true;
+}
+
+/**
+ * Hierarchical digitization of implicit shapes, compared to the
+ * evaluation of every point.
+ */
+bool testHierarchicalShaper()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing hierarchical shaper ..." );
+  Z2i::Point c2( 3, -7 );
+  Z3i::Point c3( -5, 2, 11 );
+
+  nbok += sameAsBruteForce<Z2i::DigitalSet>
+    ( ImplicitBall<Z2i::Space>( c2, 100 ), 1 ) ? 1 : 0; 
+  nb++;
+  nbok += sameAsBruteForce<Z2i::DigitalSet>
+    ( ImplicitHyperCube<Z2i::Space>( c2, 70 ), 1 ) ? 1 : 0; 
+  nb++;
+  nbok += sameAsBruteForce<Z2i::DigitalSet>
+    ( ImplicitNorm1Ball<Z2i::Space>( c2, 90 ), 1 ) ? 1 : 0; 
+  nb++;
+  nbok += sameAsBruteForce<Z2i::DigitalSet>
+    ( ImplicitRoundedHyperCube<Z2i::Space>( c2, 80, 2.5 ), 1 ) ? 1 : 0; 
+  nb++;
+  nbok += sameAsBruteForce<Z2i::DigitalSet>
+    ( ImplicitRoundedHyperCube<Z2i::Space>( c2, 80, 0.7 ), 2 ) ? 1 : 0; 
+  nb++;
+  nbok += sameAsBruteForce<Z3i::DigitalSet>
+    ( ImplicitBall<Z3i::Space>( c3, 40 ), 0 ) ? 1 : 0; 
+  nb++;
+  nbok += sameAsBruteForce<Z3i::DigitalSet>
+    ( ImplicitRoundedHyperCube<Z3i::Space>( c3, 35, 2.5 ), 2 ) ? 1 : 0; 
+  nb++;
+  nbok += sameAsBruteForce<Z3i::DigitalSet>
+    ( ImplicitNorm1Ball<Z3i::Space>( c3, 30 ), 1 ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "hierarchical shaper == brute force" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -164,7 +236,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testImplicitShape() && testImplicitShape3D(); // && ... other tests
+  bool res = testImplicitShape() && testImplicitShape3D()
+    && testHierarchicalShaper(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -33,6 +33,11 @@
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/shapes/Shapes.h"
 #include "DGtal/shapes/parametric/Ball2D.h"
+#include "DGtal/shapes/parametric/Flower2D.h"
+#include "DGtal/shapes/parametric/AccFlower2D.h"
+#include "DGtal/shapes/parametric/Ellipse2D.h"
+#include "DGtal/shapes/parametric/NGon2D.h"
+#include "DGtal/geometry/nd/GaussDigitizer.h"
 #include "DGtal/io/boards/Board2D.h"
 #include "DGtal/io/colormaps/GrayScaleColorMap.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
@@ -85,6 +90,73 @@ bool testParametricShape()
   return nbok == nb;
 }
 
+/**
+ * @return 'true' iff Shapes::shaper with [nbThreads] threads gives
+ * the same set as the evaluation of every point of the domain of the
+ * Gauss digitization of [aShape] with grid step [h].
+ */
+template <typename TShape>
+bool sameAsBruteForce( const TShape & aShape, double h, 
+           unsigned int nbThreads )
+{
+  typedef GaussDigitizer<Z2i::Space,TShape> Digitizer;
+  Digitizer dig;
+  dig.attach( aShape );
+  dig.init( aShape.getLowerBound(), aShape.getUpperBound(), h );
+  Z2i::Domain domain = dig.getDomain();
+  Z2i::DigitalSet set( domain );
+  Z2i::DigitalSet reference( domain );
+  Shapes<Z2i::Domain>::shaper( set, dig, nbThreads );
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), 
+    itEnd = domain.end(); it != itEnd; ++it )
+    if ( dig.isInside( *it ) )
+      reference.insert( *it );
+  trace.info() << "shaper: " << set.size() << " points, expected "
+         << reference.size() << std::endl;
+  if ( set.size() != reference.size() )
+    return false;
+  for ( Z2i::DigitalSet::ConstIterator it = reference.begin(), 
+    itEnd = reference.end(); it != itEnd; ++it )
+    if ( set.find( *it ) == set.end() )
+      return false;
+  return true;
+}
+
+/**
+ * Hierarchical digitization of Gauss-digitized parametric shapes,
+ * compared to the evaluation of every point.
+ */
+bool testHierarchicalShaper()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing hierarchical shaper ..." );
+  nbok += sameAsBruteForce( Ball2D<Z2i::Space>( 0.3, -0.2, 5.0 ), 
+          0.05, 1 ) ? 1 : 0; 
+  nb++;
+  nbok += sameAsBruteForce( Flower2D<Z2i::Space>( 0.5, -0.3, 5.0, 2.0, 5, 0.3 ), 
+          0.05, 1 ) ? 1 : 0; 
+  nb++;
+  nbok += sameAsBruteForce( AccFlower2D<Z2i::Space>( 0.5, -0.3, 5.0, 2.0, 3, 0.3 ), 
+          0.05, 2 ) ? 1 : 0; 
+  nb++;
+  nbok += sameAsBruteForce( Ellipse2D<Z2i::Space>( 0.1, 0.2, 5.0, 3.0, 0.5 ), 
+          0.05, 0 ) ? 1 : 0; 
+  nb++;
+  nbok += sameAsBruteForce( NGon2D<Z2i::Space>( -0.2, 0.4, 5.0, 5, 0.2 ), 
+          0.05, 1 ) ? 1 : 0; 
+  nb++;
+  nbok += sameAsBruteForce( NGon2D<Z2i::Space>( -0.2, 0.4, 5.0, 3, 0.0 ), 
+          0.02, 1 ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "hierarchical shaper == brute force" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -96,7 +168,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testParametricShape(); // && ... other tests
+  bool res = testParametricShape()
+    && testHierarchicalShaper(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
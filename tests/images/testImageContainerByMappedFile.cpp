@@ -0,0 +1,247 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByMappedFile.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/20
+ *
+ * Functions for testing class ImageContainerByMappedFile.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByMappedFile.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/LongvolReader.h"
+#include "DGtal/io/readers/RawReader.h"
+
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByMappedFile.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Mapped vol file against the imported one.
+ */
+bool testMappedVol()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing mapped vol file ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  typedef ImageContainerByMappedFile<Z3i::Domain, unsigned char> MappedImage;
+
+  std::string filename = testPath + "samples/cat10.vol";
+  Image image = VolReader<Image>::importVol( filename );
+  MappedImage mapped = VolReader<MappedImage>::mapVol( filename );
+  trace.info() << mapped << endl;
+
+  nbok += ( ( mapped.lowerBound() == image.lowerBound() )
+            && ( mapped.upperBound() == image.upperBound() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same bounds" << std::endl;
+
+  bool same = true;
+  Z3i::Domain domain = mapped.domain();
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    same = same && ( mapped( *it ) == image( *it ) );
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same values at each point" << std::endl;
+
+  unsigned int nbval = 0;
+  for ( MappedImage::ConstIterator it = mapped.begin(), itend = mapped.end();
+        it != itend; ++it )
+    if ( *it != 0 )
+      nbval++;
+  nbok += ( nbval == 8043 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "nbval=" << nbval << " == 8043" << std::endl;
+
+  // Spans along each dimension.
+  same = true;
+  Z3i::Point p( 3, 4, 5 );
+  for ( Dimension k = 0; k < 3; ++k )
+    {
+      Z3i::Point q = p;
+      q[ k ] = mapped.lowerBound()[ k ];
+      for ( MappedImage::SpanIterator it = mapped.spanBegin( q, k ),
+              itend = mapped.spanEnd( q, k ); it != itend; ++it, ++q[ k ] )
+        same = same && ( *it == image( q ) );
+      same = same && ( q[ k ] == mapped.upperBound()[ k ] + 1 );
+    }
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "span iterators" << std::endl;
+
+  // Values are changed in memory only.
+  Z3i::Point c( 5, 5, 5 );
+  unsigned char old = mapped( c );
+  MappedImage copy = mapped;
+  mapped.setValue( c, old + 1 );
+  MappedImage mapped2 = VolReader<MappedImage>::mapVol( filename );
+  nbok += ( ( mapped( c ) == (unsigned char)( old + 1 ) )
+            && ( copy( c ) == mapped( c ) )
+            && ( mapped2( c ) == old ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "setValue does not modify the file" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Mapped longvol file, whose values are not aligned in memory.
+ */
+bool testMappedLongvol()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing mapped longvol file ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint64_t> Image;
+  typedef ImageContainerByMappedFile<Z3i::Domain, DGtal::uint64_t> MappedImage;
+
+  std::ofstream out( "mapped-longvol.longvol" );
+  out << "X: 7" << endl << "Y: 5" << endl << "Z: 3" << endl;
+  out << "Lvoxel-Size: 4" << endl << "Alpha-Color: 0" << endl;
+  out << "Lvoxel-Endian: 0" << endl << "Int-Endian: 0123" << endl;
+  out << "Version: 2" << endl << "." << endl;
+  out.close();
+  out.open( "mapped-longvol.longvol", ios_base::binary | ios_base::app );
+  DGtal::uint64_t val = 1;
+  for ( unsigned int i = 0; i < 7 * 5 * 3; ++i, val = val * 5 + 0x0123456789ULL )
+    {
+      DGtal::uint64_t w = val;
+      for ( unsigned int j = 0; j < 8; ++j, w >>= 8 )
+        out.put( static_cast<char>( w & 0xFF ) );
+    }
+  out.close();
+
+  Image image = LongvolReader<Image>::importLongvol( "mapped-longvol.longvol" );
+  MappedImage mapped = LongvolReader<MappedImage>::mapLongvol( "mapped-longvol.longvol" );
+  trace.info() << mapped << endl;
+
+  bool same = true;
+  Z3i::Domain domain = mapped.domain();
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    same = same && ( mapped( *it ) == image( *it ) );
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same values at each point" << std::endl;
+
+  MappedImage::Iterator it = mapped.begin();
+  ++it;
+  mapped.setValue( it, 0xFEDCBA9876543210ULL );
+  nbok += ( mapped( Z3i::Point( 1, 0, 0 ) ) == 0xFEDCBA9876543210ULL ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "setValue on unaligned values" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Mapped raw file and IO errors.
+ */
+bool testMappedRaw()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing mapped raw file ..." );
+
+  typedef ImageContainerBySTLVector<Z2i::Domain, unsigned char> Image;
+  typedef ImageContainerByMappedFile<Z2i::Domain, unsigned char> MappedImage;
+
+  std::string filename = testPath + "samples/raw2D-64x64.raw";
+  Z2i::Vector ext( 16, 16 );
+  Image image = RawReader<Image>::importRaw8( filename, ext );
+  MappedImage mapped = RawReader<MappedImage>::mapRaw8( filename, ext );
+
+  bool same = true;
+  Z2i::Domain domain = mapped.domain();
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    same = same && ( mapped( *it ) == image( *it ) );
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same values at each point" << std::endl;
+
+  bool caught = false;
+  try
+    {
+      MappedImage tooBig = RawReader<MappedImage>::mapRaw8( filename, Z2i::Vector( 17, 16 ) );
+    }
+  catch ( exception & e )
+    {
+      caught = true;
+    }
+  nbok += caught ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "file too small for the extent" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImageContainerByMappedFile" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testMappedVol() && testMappedLongvol() && testMappedRaw();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <fstream>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/io/readers/PNMReader.h"
@@ -72,6 +73,139 @@ bool testPNMReader()
   return nbok == nb;
 }
 
+/**
+ * Reads small hand-written files in the ASCII and binary formats, 8
+ * and 16 bits.
+ */
+bool testPNMFormats()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;  
+  trace.beginBlock ( "Testing PNM formats ..." );
+
+  typedef ImageSelector < Z2i::Domain, unsigned int>::Type Image;
+  typedef ImageSelector < Z3i::Domain, unsigned int>::Type Image3D;
+  // 4x3 picture, first row on top.
+  unsigned int values[ 12 ] = { 0, 1, 2, 3, 40, 50, 60, 70, 255, 128, 7, 9 };
+  unsigned int values16[ 12 ] = { 0, 1, 2, 300, 40, 5000, 60, 70, 65535, 128, 7, 256 };
+
+  std::ofstream out( "testPNMReader-P2.pgm", ios_base::binary );
+  out << "P2\n# comment\n4 3\n# other comment\n255\n";
+  for ( unsigned int i = 0; i < 12; ++i )
+    out << values[ i ] << ( ( i % 4 == 3 ) ? "\n" : "  " );
+  out.close();
+  out.open( "testPNMReader-P5.pgm", ios_base::binary );
+  out << "P5 4 3 255\n";
+  for ( unsigned int i = 0; i < 12; ++i )
+    out.put( (char) values[ i ] );
+  out.close();
+  out.open( "testPNMReader-P5-16.pgm", ios_base::binary );
+  out << "P5\n4 3\n65535\n";
+  for ( unsigned int i = 0; i < 12; ++i )
+    {
+      out.put( (char) ( values16[ i ] >> 8 ) );
+      out.put( (char) ( values16[ i ] & 0xFF ) );
+    }
+  out.close();
+
+  Image imageP2 = PNMReader<Image>::importPGMImage( "testPNMReader-P2.pgm" );
+  Image imageP5 = PNMReader<Image>::importPGMImage( "testPNMReader-P5.pgm" );
+  Image imageP516 = PNMReader<Image>::importPGMImage( "testPNMReader-P5-16.pgm" );
+  bool ok2 = ( imageP2.extent() == Z2i::Vector( 4, 3 ) );
+  bool ok5 = ( imageP5.extent() == Z2i::Vector( 4, 3 ) );
+  bool ok16 = ( imageP516.extent() == Z2i::Vector( 4, 3 ) );
+  for ( unsigned int i = 0; i < 12; ++i )
+    {
+      Z2i::Point p( i % 4, 2 - i / 4 );
+      ok2 = ok2 && ( imageP2( p ) == values[ i ] );
+      ok5 = ok5 && ( imageP5( p ) == values[ i ] );
+      ok16 = ok16 && ( imageP516( p ) == values16[ i ] );
+    }
+  nbok += ok2 ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "P2 values" << std::endl;
+  nbok += ok5 ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "P5 values" << std::endl;
+  nbok += ok16 ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "P5 16 bits values" << std::endl;
+
+  out.open( "testPNMReader-P3.ppm", ios_base::binary );
+  out << "P3\n4 3\n255\n";
+  for ( unsigned int i = 0; i < 12; ++i )
+    out << values[ i ] << " " << values[ 11 - i ] << " " << i << "\n";
+  out.close();
+  out.open( "testPNMReader-P6.ppm", ios_base::binary );
+  out << "P6\n4 3\n255\n";
+  for ( unsigned int i = 0; i < 12; ++i )
+    {
+      out.put( (char) values[ i ] );
+      out.put( (char) values[ 11 - i ] );
+      out.put( (char) i );
+    }
+  out.close();
+  Image imageP3 = PNMReader<Image>::importPPMImage( "testPNMReader-P3.ppm" );
+  Image imageP6 = PNMReader<Image>::importPPMImage( "testPNMReader-P6.ppm" );
+  bool ok = true;
+  for ( unsigned int i = 0; i < 12; ++i )
+    {
+      Z2i::Point p( i % 4, 2 - i / 4 );
+      unsigned int color = ( values[ i ] << 16 ) | ( values[ 11 - i ] << 8 ) | i;
+      ok = ok && ( imageP3( p ) == color ) && ( imageP6( p ) == color );
+    }
+  nbok += ok ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "P3 and P6 colors" << std::endl;
+
+  // 2x3x2 volume, values 0..11.
+  out.open( "testPNMReader-P3d.pgm3d", ios_base::binary );
+  out << "P3d\n2 3 2\n255\n";
+  for ( unsigned int i = 0; i < 12; ++i )
+    out.put( (char) ( 20 * i ) );
+  out.close();
+  out.open( "testPNMReader-P2-3D.pgm3d", ios_base::binary );
+  out << "P2-3D\n#DGtal\n\n2 3 2\n1000\n";
+  for ( unsigned int i = 0; i < 12; ++i )
+    out << 80 * i << " ";
+  out.close();
+  Image3D imageP3d = PNMReader<Image3D>::importPGM3D( "testPNMReader-P3d.pgm3d" );
+  Image3D imageP23D = PNMReader<Image3D>::importPGM3D( "testPNMReader-P2-3D.pgm3d" );
+  ok = true;
+  for ( unsigned int i = 0; i < 12; ++i )
+    {
+      Z3i::Point p( i % 2, 2 - ( i / 2 ) % 3, i / 6 );
+      ok = ok && ( imageP3d( p ) == 20 * i ) && ( imageP23D( p ) == 80 * i );
+    }
+  nbok += ok ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "P3d and P2-3D values" << std::endl;
+
+  out.open( "testPNMReader-short.pgm", ios_base::binary );
+  out << "P5\n4 3\n255\n" << "0123456789";
+  out.close();
+  bool caught = false;
+  try
+    {
+      Image image = PNMReader<Image>::importPGMImage( "testPNMReader-short.pgm" );
+    }
+  catch( exception & e )
+    {
+      caught = true;
+    }
+  nbok += caught ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "truncated file" << std::endl;
+  trace.endBlock();  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -83,7 +217,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testPNMReader(); // && ... other tests
+  bool res = testPNMReader() && testPNMFormats(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
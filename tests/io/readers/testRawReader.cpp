@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <cstdio>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/kernel/SpaceND.h"
@@ -80,6 +81,21 @@ bool testRawReader2D()
   ///FIXME: check io errors
   trace.info() << image <<endl;
 
+  // The image should contain the first 16*16 bytes of the file, row
+  // by row.
+  unsigned char bytes[ 256 ];
+  FILE* fin = fopen( filename.c_str(), "rb" );
+  size_t nbBytes = ( fin != NULL ) ? fread( bytes, 1, 256, fin ) : 0;
+  if ( fin != NULL ) fclose( fin );
+  bool allFine = ( nbBytes == 256 );
+  for ( unsigned int y = 0; allFine && ( y < 16 ); ++y )
+    for ( unsigned int x = 0; x < 16; ++x )
+      allFine &= ( image( TDomain::Point( x, y ) ) == bytes[ y * 16 + x ] );
+  nbok += allFine ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "image values == file bytes" << std::endl;
+
   //export
   typedef GrayscaleColorMap<unsigned char> Gray;  
   PNMWriter<Image,Gray>::exportPGM("export-raw-reader.pgm",image,0,255);
@@ -0,0 +1,154 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVolReader-benchmark.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/19
+ *
+ * Benchmark of the block import of VolReader against a voxel by
+ * voxel import, and of the mapping of a vol file.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdio>
+#include <cstring>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByMappedFile.h"
+#include "DGtal/io/colormaps/GrayScaleColorMap.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/writers/VolWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+         << #x << std::endl;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+
+/**
+ * Voxel by voxel import of a vol file (with getc and setValue), as
+ * done before the block import.
+ *
+ * @param filename a vol file.
+ * @param image (modified) an image with the extent of the file.
+ * @return the number of voxels read.
+ */
+long int importVoxelByVoxel( const std::string & filename, Image & image )
+{
+  FILE* fin = fopen( filename.c_str(), "rb" );
+  if ( fin == NULL ) return 0;
+  char line[ 128 ];
+  while ( ( fgets( line, 128, fin ) != NULL ) && ( strcmp( line, ".\n" ) != 0 ) )
+    ;
+  Z3i::Domain domain( image.lowerBound(), image.upperBound() );
+  long int count = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      int val = getc( fin );
+      if ( val == EOF ) break;
+      image.setValue( *it, (unsigned char) val );
+      ++count;
+    }
+  fclose( fin );
+  return count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class VolReader.
+///////////////////////////////////////////////////////////////////////////////
+
+bool benchmarkVolReader()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  Z3i::Point low( 0, 0, 0 );
+  Z3i::Point high( 255, 255, 255 );
+  Z3i::Domain domain( low, high );
+  Image image( low, high );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    image.setValue( *it, (unsigned char) ( ( (*it)[ 0 ] ^ (*it)[ 1 ] ) + (*it)[ 2 ] ) );
+
+  trace.beginBlock ( "Exporting a 256^3 vol file ..." );
+  VolWriter<Image, GrayscaleColorMap<unsigned char> >
+    ::exportVol( "benchmark-volreader.vol", image, 0, 255 );
+  trace.endBlock();
+
+  Image image1( low, high );
+  trace.beginBlock ( "Voxel by voxel import ..." );
+  long int count = importVoxelByVoxel( "benchmark-volreader.vol", image1 );
+  trace.endBlock();
+  INBLOCK_TEST( count == 256 * 256 * 256 );
+
+  trace.beginBlock ( "Block import with VolReader ..." );
+  Image image2 = VolReader<Image>::importVol( "benchmark-volreader.vol" );
+  trace.endBlock();
+
+  bool same = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    same = same && ( image1( *it ) == image2( *it ) );
+  INBLOCK_TEST( same );
+
+  typedef ImageContainerByMappedFile<Z3i::Domain, unsigned char> MappedImage;
+  trace.beginBlock ( "Mapping with VolReader and reading one slice ..." );
+  MappedImage image3 = VolReader<MappedImage>::mapVol( "benchmark-volreader.vol" );
+  unsigned int sum = 0;
+  for ( MappedImage::SpanIterator it = image3.spanBegin( Z3i::Point( 7, 9, 0 ), 2 ),
+          itend = image3.spanEnd( Z3i::Point( 7, 9, 0 ), 2 ); it != itend; ++it )
+    sum += *it;
+  trace.endBlock();
+  unsigned int sum2 = 0;
+  for ( int z = 0; z < 256; ++z )
+    sum2 += image2( Z3i::Point( 7, 9, z ) );
+  INBLOCK_TEST( sum == sum2 );
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class VolReader" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = benchmarkVolReader();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <map>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
@@ -104,6 +105,69 @@ bool testVolReader()
 }
 
 
+typedef HyperRectDomain< SpaceND<3> > Domain3;
+
+/**
+ * A minimal image container without linearized storage, filled
+ * point by point by the readers.
+ */
+struct MapImage
+{
+  typedef Domain3 Domain;
+  typedef Domain::Point Point;
+  typedef unsigned char Value;
+  MapImage( const Point & a, const Point & b )
+    : myLowerBound( a ), myUpperBound( b )
+  {}
+  void setValue( const Point & p, const Value & v )
+  {
+    myValues[ p ] = v;
+  }
+  Value operator()( const Point & p ) const
+  {
+    std::map<Point,Value>::const_iterator it = myValues.find( p );
+    return ( it != myValues.end() ) ? it->second : 0;
+  }
+  Point myLowerBound;
+  Point myUpperBound;
+  std::map<Point,Value> myValues;
+};
+
+/**
+ * The block import into an ImageContainerBySTLVector should give the
+ * same image as the generic (point by point) import.
+ */
+bool testVolReaderBlocks()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing VolReader block import ..." );
+
+  typedef Domain3 TDomain;
+  typedef ImageContainerBySTLVector<TDomain, unsigned char> VectorImage;
+  
+  std::string filename = testPath + "samples/cat10.vol";
+  VectorImage image = VolReader<VectorImage>::importVol( filename );
+  MapImage image2 = VolReader<MapImage>::importVol( filename );
+
+  TDomain domain( image.lowerBound(), image.upperBound() );
+  unsigned int nbdiff = 0;
+  for ( TDomain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    if ( image( *it ) != image2( *it ) )
+      nbdiff++;
+  trace.info() << "Number of different values = " << nbdiff << endl;
+
+  nbok += ( nbdiff == 0 ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "vector import == map import" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 bool testIOException()
 {
    unsigned int nbok = 0;
@@ -152,7 +216,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testVolReader() && testIOException(); // && ... other tests
+  bool res = testVolReader() && testVolReaderBlocks() && testIOException(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,239 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testChunkVol.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/25
+ *
+ * Functions for testing classes ChunkVolReader and ChunkVolWriter.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/ChunkVolReader.h"
+#include "DGtal/io/writers/ChunkVolWriter.h"
+
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> LabelImage;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes ChunkVolReader and ChunkVolWriter.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return the content of a file.
+ */
+std::string fileContent( const std::string & filename )
+{
+  std::ifstream in( filename.c_str(), ios_base::binary );
+  std::ostringstream content;
+  content << in.rdbuf();
+  return content.str();
+}
+
+/**
+ * @return 'true' if the images have the same values on a domain.
+ */
+template <typename Image1, typename Image2>
+bool sameValues( const Image1 & image1, const Image2 & image2,
+                 const Z3i::Domain & domain )
+{
+  bool same = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    same = same && ( image1( *it ) == image2( *it ) );
+  return same;
+}
+
+/**
+ * @return a label image (boxes of labels on a zero background).
+ */
+LabelImage makeLabels()
+{
+  Z3i::Point low( 0, 0, 0 );
+  Z3i::Point up( 49, 36, 44 );
+  Z3i::Domain domain( low, up );
+  LabelImage image( low, up );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      Z3i::Point p = *it;
+      DGtal::uint32_t label = 0;
+      if ( ( p[ 0 ] % 12 < 7 ) && ( p[ 1 ] % 9 < 5 ) && ( p[ 2 ] % 11 < 6 ) )
+        label = 1 + p[ 0 ] / 12 + 5 * ( p[ 1 ] / 9 ) + 25 * ( p[ 2 ] / 11 ) + 100000;
+      if ( ( p[ 0 ] * 13 + p[ 1 ] * 7 + p[ 2 ] * 3 ) % 97 == 0 )
+        label = 0xFFFFFFFF;
+      image.setValue( p, label );
+    }
+  return image;
+}
+
+/**
+ * Export and import of whole volumes.
+ */
+bool testChunkVolWhole()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing export and import ..." );
+  LabelImage labels = makeLabels();
+  Z3i::Domain domain( labels.lowerBound(), labels.upperBound() );
+
+  int brickSizes[] = { 1, 7, 16, 64 };
+  for ( unsigned int i = 0; i < 4; ++i )
+    {
+      ChunkVolWriter<LabelImage>::exportChunkVol( "chunkvol-labels.cvol", labels,
+                                                  brickSizes[ i ] );
+      LabelImage image = ChunkVolReader<LabelImage>::importChunkVol( "chunkvol-labels.cvol" );
+      nbok += ( ( image.lowerBound() == labels.lowerBound() )
+                && ( image.upperBound() == labels.upperBound() )
+                && sameValues( image, labels, domain ) ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "brick size " << brickSizes[ i ] << ", "
+                   << fileContent( "chunkvol-labels.cvol" ).size() << " bytes" << std::endl;
+    }
+
+  std::size_t rawSize = 50 * 37 * 45 * sizeof( DGtal::uint32_t );
+  nbok += ( fileContent( "chunkvol-labels.cvol" ).size() * 10 < rawSize ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "compressed size lower than raw size / 10" << std::endl;
+
+  ChunkVolWriter<LabelImage>::exportChunkVol( "chunkvol-labels-mt.cvol", labels, 16, 4 );
+  ChunkVolWriter<LabelImage>::exportChunkVol( "chunkvol-labels.cvol", labels, 16, 1 );
+  nbok += ( fileContent( "chunkvol-labels.cvol" )
+            == fileContent( "chunkvol-labels-mt.cvol" ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same file with 4 threads" << std::endl;
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  Image cat = VolReader<Image>::importVol( testPath + "samples/cat10.vol" );
+  ChunkVolWriter<Image>::exportChunkVol( "chunkvol-cat10.cvol", cat, 8 );
+  Image cat2 = ChunkVolReader<Image>::importChunkVol( "chunkvol-cat10.cvol" );
+  nbok += sameValues( cat, cat2, Z3i::Domain( cat.lowerBound(), cat.upperBound() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "cat10.vol " << fileContent( "chunkvol-cat10.cvol" ).size()
+               << " bytes" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Import of parts and update.
+ */
+bool testChunkVolRandomAccess()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing random access ..." );
+  LabelImage labels = makeLabels();
+  ChunkVolWriter<LabelImage>::exportChunkVol( "chunkvol-labels.cvol", labels, 8 );
+
+  Z3i::Domain part( Z3i::Point( 5, 9, 13 ), Z3i::Point( 30, 17, 38 ) );
+  LabelImage image = ChunkVolReader<LabelImage>::importChunkVol( "chunkvol-labels.cvol",
+                                                                 part );
+  nbok += ( ( image.lowerBound() == part.lowerBound() )
+            && ( image.upperBound() == part.upperBound() )
+            && sameValues( image, labels, part ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "import of " << part << std::endl;
+
+  Z3i::Domain outside( Z3i::Point( -4, 30, 40 ), Z3i::Point( 8, 60, 100 ) );
+  Z3i::Domain clipped( Z3i::Point( 0, 30, 40 ), Z3i::Point( 8, 36, 44 ) );
+  image = ChunkVolReader<LabelImage>::importChunkVol( "chunkvol-labels.cvol", outside );
+  nbok += ( ( image.lowerBound() == clipped.lowerBound() )
+            && ( image.upperBound() == clipped.upperBound() )
+            && sameValues( image, labels, clipped ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "import clipped to the volume" << std::endl;
+
+  // Update of a part crossing several bricks.
+  Z3i::Domain updated( Z3i::Point( 3, 4, 5 ), Z3i::Point( 20, 21, 9 ) );
+  LabelImage labels2 = labels;
+  for ( Z3i::Domain::ConstIterator it = updated.begin(), itend = updated.end();
+        it != itend; ++it )
+    labels2.setValue( *it, 42 + (*it)[ 0 ] );
+  ChunkVolWriter<LabelImage>::updateChunkVol( "chunkvol-labels.cvol", labels2, updated );
+  image = ChunkVolReader<LabelImage>::importChunkVol( "chunkvol-labels.cvol" );
+  nbok += sameValues( image, labels2, Z3i::Domain( labels.lowerBound(),
+                                                   labels.upperBound() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "update of " << updated << std::endl;
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  bool caught = false;
+  try
+    {
+      Image wrong = ChunkVolReader<Image>::importChunkVol( "chunkvol-labels.cvol" );
+    }
+  catch ( exception & e )
+    {
+      caught = true;
+    }
+  nbok += caught ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "wrong value size" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing chunked volumes" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testChunkVolWhole() && testChunkVolRandomAccess();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
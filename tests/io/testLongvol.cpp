@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <fstream>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/images/ImageSelector.h"
@@ -84,6 +85,54 @@ bool testLongvol()
   return nbok == nb;
 }
 
+/**
+ * Values using all the 64 bits of the words should be read back.
+ */
+bool testLongvolWords()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing Longvol reader with 64-bit values ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain,DGtal::uint64_t> Image;
+  Z3i::Point a(0,0,0);
+  Z3i::Point b(4,3,2);
+  Z3i::Domain domain(a,b);
+
+  std::ofstream out( "export-longvol-words.longvol" );
+  out << "X: 5" << endl << "Y: 4" << endl << "Z: 3" << endl;
+  out << "Lvoxel-Size: 4" << endl << "Alpha-Color: 0" << endl;
+  out << "Lvoxel-Endian: 0" << endl << "Int-Endian: 0123" << endl;
+  out << "Version: 2" << endl << "." << endl;
+  out.close();
+  out.open( "export-longvol-words.longvol", ios_base::binary | ios_base::app );
+  DGtal::uint64_t val = 1;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it, val = val * 3 + 0x0123456789ULL )
+    {
+      DGtal::uint64_t w = val;
+      for ( unsigned int i = 0; i < 8; ++i, w >>= 8 )
+        out.put( static_cast<char>( w & 0xFF ) );
+    }
+  out.close();
+
+  Image image = LongvolReader<Image>::importLongvol( "export-longvol-words.longvol" );
+  bool allFine = true;
+  val = 1;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it, val = val * 3 + 0x0123456789ULL )
+    allFine &= ( image( *it ) == val );
+
+  nbok += allFine ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "read values == written values" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -95,7 +144,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testLongvol(); // && ... other tests
+  bool res = testLongvol() && testLongvolWords(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,361 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSlabProcessing.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/23
+ *
+ * Functions for testing classes SlabReader, SlabWriter and
+ * SlabProcessing.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/colormaps/GrayScaleColorMap.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/SlabReader.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/writers/RawWriter.h"
+#include "DGtal/io/writers/SlabWriter.h"
+#include "DGtal/io/SlabProcessing.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+typedef GrayscaleColorMap<unsigned char> Gray;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes SlabReader, SlabWriter and SlabProcessing.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return the content of a file.
+ */
+std::string fileContent( const std::string & filename )
+{
+  std::ifstream in( filename.c_str(), ios_base::binary );
+  std::ostringstream content;
+  content << in.rdbuf();
+  return content.str();
+}
+
+/**
+ * Creates the test volume (a few blocks and balls with 4 values),
+ * exports it in "slab-input.vol" and "slab-input.raw" and returns
+ * it as read from the vol file.
+ */
+Image makeVolume()
+{
+  Z3i::Point low( 0, 0, 0 );
+  Z3i::Point up( 22, 17, 29 );
+  Z3i::Domain domain( low, up );
+  Image image( low, up );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      Z3i::Point p = *it;
+      Z3i::Point c( 11, 8, 14 );
+      unsigned char val = (unsigned char)
+        ( ( ( p[ 0 ] / 5 + p[ 1 ] / 6 + p[ 2 ] / 4 ) % 3 ) * 60 );
+      if ( ( p - c ).norm() < 6.5 )
+        val = 200;
+      if ( ( ( p[ 0 ] * 7 + p[ 1 ] * 3 + p[ 2 ] * 5 ) % 29 ) == 0 )
+        val = 0;
+      image.setValue( p, val );
+    }
+  VolWriter<Image, Gray>::exportVol( "slab-input.vol", image, 0, 255 );
+  RawWriter<Image, Gray>::exportRaw8( "slab-input.raw", image, 0, 255 );
+  return VolReader<Image>::importVol( "slab-input.vol" );
+}
+
+/**
+ * Reads the volume slab by slab and checks the slabs.
+ */
+bool testSlabReader( const Image & image )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing SlabReader ..." );
+  int slabSizes[] = { 1, 7, 30, 64 };
+  int overlaps[] = { 0, 2 };
+  for ( unsigned int i = 0; i < 4; ++i )
+    for ( unsigned int j = 0; j < 2; ++j )
+      for ( unsigned int k = 0; k < 2; ++k )
+        {
+          SlabReader<Image> reader( slabSizes[ i ], overlaps[ j ] );
+          if ( k == 0 )
+            reader.openVol( "slab-input.vol" );
+          else
+            reader.openRaw8( "slab-input.raw", image.extent() );
+          bool ok = ( reader.extent() == image.extent() );
+          int nextZ = 0;
+          unsigned int nbSlabs = 0;
+          while ( reader.nextSlab() )
+            {
+              const Image & slab = reader.slab();
+              Z3i::Domain core = reader.coreDomain();
+              ok = ok && ( core.lowerBound()[ 2 ] == nextZ );
+              ok = ok && ( slab.lowerBound()[ 2 ]
+                           == std::max( nextZ - overlaps[ j ], 0 ) );
+              ok = ok && ( slab.upperBound()[ 2 ]
+                           == std::min( core.upperBound()[ 2 ] + overlaps[ j ],
+                                        image.upperBound()[ 2 ] ) );
+              Z3i::Domain domain( slab.lowerBound(), slab.upperBound() );
+              for ( Z3i::Domain::ConstIterator it = domain.begin(),
+                      itend = domain.end(); it != itend; ++it )
+                ok = ok && ( slab( *it ) == image( *it ) );
+              nextZ = core.upperBound()[ 2 ] + 1;
+              ++nbSlabs;
+            }
+          ok = ok && ( nextZ == image.extent()[ 2 ] )
+            && ( nbSlabs == (unsigned int)
+                 ( ( image.extent()[ 2 ] + slabSizes[ i ] - 1 ) / slabSizes[ i ] ) );
+          nbok += ok ? 1 : 0;
+          nb++;
+          trace.info() << "(" << nbok << "/" << nb << ") " << reader
+                       << ( k == 0 ? " vol" : " raw" ) << std::endl;
+        }
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Streamed thresholding against the exported thresholded volume.
+ */
+bool testSlabThreshold( const Image & image )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing SlabThreshold ..." );
+  typedef SlabThreshold<Image> Threshold;
+  Image thresholded( image.lowerBound(), image.upperBound() );
+  SimpleForegroundPredicate<Image> predicate( image, 50, 150 );
+  Z3i::Domain domain( image.lowerBound(), image.upperBound() );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    thresholded.setValue( *it, predicate( *it ) ? 1 : 0 );
+  VolWriter<Image, Gray>::exportVol( "slab-threshold-ref.vol", thresholded, 0, 1 );
+  RawWriter<Image, Gray>::exportRaw8( "slab-threshold-ref.raw", thresholded, 0, 1 );
+
+  SlabReader<Image> reader( 7 );
+  reader.openVol( "slab-input.vol" );
+  Threshold threshold( 50, 150 );
+  SlabWriter<Threshold::OutputImage, Gray> writer( 0, 1 );
+  writer.openVol( "slab-threshold.vol", reader.extent() );
+  unsigned int nbSlabs = SlabProcessing::process( reader, threshold, writer );
+  writer.close();
+  nbok += ( ( nbSlabs == 5 ) && ( writer.count() == 23 * 18 * 30 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbSlabs << " slabs, " << writer << std::endl;
+  nbok += ( fileContent( "slab-threshold.vol" )
+            == fileContent( "slab-threshold-ref.vol" ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same vol file as VolWriter" << std::endl;
+
+  SlabReader<Image> reader2( 4, 1 );
+  reader2.openRaw8( "slab-input.raw", image.extent() );
+  writer.openRaw8( "slab-threshold.raw" );
+  SlabProcessing::process( reader2, threshold, writer );
+  writer.close();
+  nbok += ( fileContent( "slab-threshold.raw" )
+            == fileContent( "slab-threshold-ref.raw" ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same raw file as RawWriter" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Streamed x and y steps of the distance transformation against
+ * the partial transformation of the whole volume.
+ */
+bool testSlabDistanceTransformation( const Image & image )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing SlabDistanceTransformation ..." );
+  typedef SlabDistanceTransformation<Image, 2> SlabDT;
+  typedef SlabDT::OutputImage OutputImage;
+  const DGtal::int64_t infinity = 10000;
+
+  SlabDT::DT dt;
+  OutputImage ref = dt.computePartial( image, 2 );
+  Z3i::Domain domain( image.lowerBound(), image.upperBound() );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    if ( ref( *it ) >= dt.infinity() )
+      ref.setValue( *it, infinity );
+
+  int slabSizes[] = { 1, 8, 30 };
+  for ( unsigned int i = 0; i < 3; ++i )
+    {
+      SlabReader<Image> reader( slabSizes[ i ], i );
+      reader.openVol( "slab-input.vol" );
+      SlabDT slabDT( infinity );
+      bool ok = true;
+      while ( reader.nextSlab() )
+        {
+          Z3i::Domain core = reader.coreDomain();
+          OutputImage output( core.lowerBound(), core.upperBound() );
+          slabDT( reader.slab(), core, output );
+          for ( Z3i::Domain::ConstIterator it = core.begin(),
+                  itend = core.end(); it != itend; ++it )
+            ok = ok && ( output( *it ) == ref( *it ) );
+        }
+      nbok += ok ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "slab size " << slabSizes[ i ] << std::endl;
+    }
+
+  typedef GrayscaleColorMap<DGtal::int64_t> LongGray;
+  VolWriter<OutputImage, LongGray>::exportVol( "slab-dt-ref.vol", ref, 0, 255 );
+  SlabReader<Image> reader( 6 );
+  reader.openVol( "slab-input.vol" );
+  SlabDT slabDT( infinity );
+  SlabWriter<OutputImage, LongGray> writer( 0, 255 );
+  writer.openVol( "slab-dt.vol", reader.extent() );
+  SlabProcessing::process( reader, slabDT, writer );
+  writer.close();
+  nbok += ( fileContent( "slab-dt.vol" ) == fileContent( "slab-dt-ref.vol" ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same vol file as VolWriter" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Streamed labelling against ConnectedComponentLabelling on the
+ * whole volume.
+ */
+bool testSlabComponentLabelling( const Image & image )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing SlabComponentLabelling ..." );
+  typedef SlabComponentLabelling<Image> Labelling;
+  typedef Labelling::OutputImage OutputImage;
+  typedef GrayscaleColorMap<Labelling::Label> LabelGray;
+
+  int slabSizes[] = { 1, 5, 30 };
+  for ( Dimension n = 1; n <= 3; n += 2 )
+    {
+      ConnectedComponentLabelling<Image> ccl( n );
+      ConnectedComponentLabelling<Image>::LabelImage ref = ccl.compute( image );
+      trace.info() << ccl.nbComponents() << " components" << std::endl;
+
+      for ( unsigned int i = 0; i < 3; ++i )
+        {
+          SlabReader<Image> reader( slabSizes[ i ], 1 );
+          reader.openVol( "slab-input.vol" );
+          Labelling labelling( n );
+          while ( reader.nextSlab() )
+            labelling.analyze( reader.slab(), reader.coreDomain() );
+          bool ok = ( labelling.nbComponents() == ccl.nbComponents() );
+          reader.rewind();
+          while ( reader.nextSlab() )
+            {
+              Z3i::Domain core = reader.coreDomain();
+              OutputImage output( core.lowerBound(), core.upperBound() );
+              labelling( reader.slab(), core, output );
+              for ( Z3i::Domain::ConstIterator it = core.begin(),
+                      itend = core.end(); it != itend; ++it )
+                ok = ok && ( output( *it ) == ref( *it ) );
+            }
+          nbok += ok ? 1 : 0;
+          nb++;
+          trace.info() << "(" << nbok << "/" << nb << ") "
+                       << "maxNorm1=" << n << " slab size " << slabSizes[ i ]
+                       << " same labels" << std::endl;
+        }
+
+      Labelling::Label maxLabel = ccl.nbComponents() - 1;
+      VolWriter<OutputImage, LabelGray>::exportVol( "slab-labels-ref.vol", ref,
+                                                    0, maxLabel );
+      SlabReader<Image> reader( 9, 1 );
+      reader.openVol( "slab-input.vol" );
+      Labelling labelling( n );
+      SlabWriter<OutputImage, LabelGray> writer( 0, maxLabel );
+      writer.openVol( "slab-labels.vol", reader.extent() );
+      SlabProcessing::process( reader, labelling, writer );
+      writer.close();
+      nbok += ( fileContent( "slab-labels.vol" )
+                == fileContent( "slab-labels-ref.vol" ) ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "same vol file as VolWriter" << std::endl;
+    }
+
+  SlabReader<Image> reader( 9 );
+  reader.openVol( "slab-input.vol" );
+  Labelling labelling( 1 );
+  SlabWriter<OutputImage, LabelGray> writer( 0, 1 );
+  writer.openVol( "slab-labels.vol", reader.extent() );
+  nbok += ( SlabProcessing::process( reader, labelling, writer ) == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "no processing without overlap" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing slab processing" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  Image image = makeVolume();
+  bool res = testSlabReader( image ) && testSlabThreshold( image )
+    && testSlabDistanceTransformation( image )
+    && testSlabComponentLabelling( image );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
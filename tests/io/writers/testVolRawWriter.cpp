@@ -0,0 +1,240 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVolRawWriter.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/26
+ *
+ * Functions for testing the buffered export of VolWriter and RawWriter.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/colormaps/GrayScaleColorMap.h"
+#include "DGtal/io/colormaps/GradientColorMap.h"
+#include "DGtal/io/colormaps/HueShadeColorMap.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/writers/ColormapGrayConverter.h"
+#include "DGtal/io/writers/RawWriter.h"
+#include "DGtal/io/writers/VolWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+         << #x << std::endl;
+
+/**
+ * Voxel by voxel export (with put), as done before the buffered
+ * export.
+ *
+ * @param image any image.
+ * @param domain the exported points.
+ * @param minV the minimum value (for colormap).
+ * @param maxV the maximum value (for colormap).
+ * @return the exported bytes.
+ */
+template <typename Image, typename Colormap>
+std::string exportVoxelByVoxel( const Image & image,
+                                const typename Image::Domain & domain,
+                                const typename Image::Value & minV,
+                                const typename Image::Value & maxV )
+{
+  std::ostringstream out;
+  Colormap colormap( minV, maxV );
+  for ( typename Image::Domain::ConstIterator it = domain.begin(),
+          itend = domain.end(); it != itend; ++it )
+    {
+      Color col = colormap( image( *it ) );
+      out.put( (unsigned char) ( ( (int) col.red() + (int) col.green()
+                                   + (int) col.blue() ) / 3 ) );
+    }
+  return out.str();
+}
+
+/**
+ * Buffered export with RawWriter::exportValues.
+ */
+template <typename Image, typename Colormap>
+std::string exportBuffered( const Image & image,
+                            const typename Image::Domain & domain,
+                            const typename Image::Value & minV,
+                            const typename Image::Value & maxV,
+                            const unsigned int nbThreads )
+{
+  std::ostringstream out;
+  RawWriter<Image, Colormap>::exportValues( out, image, domain, minV, maxV,
+                                            nbThreads );
+  return out.str();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes VolWriter and RawWriter.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Lookup table of ColormapGrayConverter.
+ */
+bool testColormapGrayConverter()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ColormapGrayConverter ..." );
+  typedef GradientColorMap<int, CMAP_JET> Jet;
+  ColormapGrayConverter<Jet> small( -100, 900 );
+  ColormapGrayConverter<Jet> large( 0, 1000000 );
+  ColormapGrayConverter< GrayscaleColorMap<double> > real( 0.0, 1.0 );
+  trace.info() << small << " " << large << " " << real << endl;
+  INBLOCK_TEST( small.hasTable() && ! large.hasTable() && ! real.hasTable() );
+
+  Jet jet( -100, 900 );
+  bool same = true;
+  for ( int v = -100; v <= 900; ++v )
+    same = same && ( small( v ) == ColormapGrayConverter<Jet>::gray( jet( v ) ) );
+  INBLOCK_TEST( same );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Buffered export against the voxel by voxel one.
+ */
+bool testBufferedExport()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing buffered export of values ..." );
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> IntImage;
+  typedef ImageContainerBySTLVector<Z3i::Domain, double> RealImage;
+  typedef GrayscaleColorMap<unsigned char> Gray;
+  typedef GradientColorMap<int, CMAP_JET> Jet;
+  typedef HueShadeColorMap<double, 2> Hue;
+
+  Z3i::Point low( -3, 2, 0 );
+  Z3i::Point high( 57, 40, 13 );
+  Z3i::Domain domain( low, high );
+  Z3i::Domain sub( Z3i::Point( 5, 10, 3 ), Z3i::Point( 20, 30, 7 ) );
+  Image image( low, high );
+  IntImage intImage( low, high );
+  RealImage realImage( low, high );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      const int v = ( (*it)[ 0 ] * 7 + (*it)[ 1 ] * 13 + (*it)[ 2 ] * 31 ) % 1000;
+      image.setValue( *it, (unsigned char) v );
+      intImage.setValue( *it, v - 100 );
+      realImage.setValue( *it, v / 999.0 );
+    }
+
+  for ( unsigned int nbThreads = 1; nbThreads <= 4; nbThreads += 3 )
+    {
+      trace.info() << "nbThreads=" << nbThreads << endl;
+      INBLOCK_TEST( ( exportBuffered<Image, Gray>( image, domain, 0, 255, nbThreads )
+                      == exportVoxelByVoxel<Image, Gray>( image, domain, 0, 255 ) ) );
+      INBLOCK_TEST( ( exportBuffered<Image, Gray>( image, sub, 10, 200, nbThreads )
+                      == exportVoxelByVoxel<Image, Gray>( image, sub, 10, 200 ) ) );
+      INBLOCK_TEST( ( exportBuffered<IntImage, Jet>( intImage, domain, -100, 899, nbThreads )
+                      == exportVoxelByVoxel<IntImage, Jet>( intImage, domain, -100, 899 ) ) );
+      INBLOCK_TEST( ( exportBuffered<IntImage, Jet>( intImage, domain, -100, 200000, nbThreads )
+                      == exportVoxelByVoxel<IntImage, Jet>( intImage, domain, -100, 200000 ) ) );
+      INBLOCK_TEST( ( exportBuffered<RealImage, Hue>( realImage, sub, 0.0, 1.0, nbThreads )
+                      == exportVoxelByVoxel<RealImage, Hue>( realImage, sub, 0.0, 1.0 ) ) );
+    }
+
+  // A 2D image whose rows are larger than the buffer.
+  typedef ImageContainerBySTLVector<Z2i::Domain, unsigned char> Image2D;
+  Z2i::Point low2( 0, 0 );
+  Z2i::Point high2( RawWriter<Image2D, Gray>::BUFFER_SIZE + 10, 2 );
+  Z2i::Domain domain2( low2, high2 );
+  Image2D image2( low2, high2 );
+  for ( Z2i::Domain::ConstIterator it = domain2.begin(), itend = domain2.end();
+        it != itend; ++it )
+    image2.setValue( *it, (unsigned char) ( (*it)[ 0 ] + (*it)[ 1 ] ) );
+  INBLOCK_TEST( ( exportBuffered<Image2D, Gray>( image2, domain2, 0, 255, 2 )
+                  == exportVoxelByVoxel<Image2D, Gray>( image2, domain2, 0, 255 ) ) );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Vol export with several threads, read back.
+ */
+bool testVolExport()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing multithreaded vol export ..." );
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  typedef GrayscaleColorMap<unsigned char> Gray;
+  Z3i::Point low( 0, 0, 0 );
+  Z3i::Point high( 30, 20, 10 );
+  Z3i::Domain domain( low, high );
+  Image image( low, high );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    image.setValue( *it, (unsigned char) ( (*it)[ 0 ] ^ ( (*it)[ 1 ] + (*it)[ 2 ] ) ) );
+  VolWriter<Image, Gray>::exportVol( "export-threads.vol", image, 0, 255, 0 );
+  Image image2 = VolReader<Image>::importVol( "export-threads.vol" );
+  bool same = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    same = same && ( image( *it ) == image2( *it ) );
+  INBLOCK_TEST( same );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing classes VolWriter and RawWriter" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testColormapGrayConverter() && testBufferedExport()
+    && testVolExport();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
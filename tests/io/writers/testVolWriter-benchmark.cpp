@@ -0,0 +1,136 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVolWriter-benchmark.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/26
+ *
+ * Benchmark of the buffered export of VolWriter against a voxel by
+ * voxel export.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/colormaps/GrayScaleColorMap.h"
+#include "DGtal/io/colormaps/GradientColorMap.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/writers/VolWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+         << #x << std::endl;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> ByteImage;
+typedef GradientColorMap<int, CMAP_JET> Jet;
+
+/**
+ * Voxel by voxel export of a vol file (with put), as done before the
+ * buffered export.
+ *
+ * @param filename the output file.
+ * @param image any image.
+ */
+void exportVoxelByVoxel( const std::string & filename, const Image & image )
+{
+  std::ofstream out( filename.c_str(), ios_base::binary );
+  VolWriter<Image, Jet>::exportHeader( out, image.extent() );
+  Z3i::Domain domain( image.lowerBound(), image.upperBound() );
+  Jet colormap( 0, 4095 );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      Color col = colormap( image( *it ) );
+      out.put( (unsigned char) ( ( (int) col.red() + (int) col.green()
+                                   + (int) col.blue() ) / 3 ) );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class VolWriter.
+///////////////////////////////////////////////////////////////////////////////
+
+bool benchmarkVolWriter()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  Z3i::Point low( 0, 0, 0 );
+  Z3i::Point high( 255, 255, 255 );
+  Z3i::Domain domain( low, high );
+  Image image( low, high );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    image.setValue( *it, ( ( (*it)[ 0 ] ^ (*it)[ 1 ] ) * 16 + (*it)[ 2 ] ) & 4095 );
+
+  trace.beginBlock ( "Voxel by voxel export of a 256^3 vol file ..." );
+  exportVoxelByVoxel( "benchmark-volwriter-1.vol", image );
+  trace.endBlock();
+
+  trace.beginBlock ( "Buffered export with VolWriter (1 thread) ..." );
+  VolWriter<Image, Jet>::exportVol( "benchmark-volwriter-2.vol", image, 0, 4095 );
+  trace.endBlock();
+
+  trace.beginBlock ( "Buffered export with VolWriter (default threads) ..." );
+  VolWriter<Image, Jet>::exportVol( "benchmark-volwriter-3.vol", image, 0, 4095, 0 );
+  trace.endBlock();
+
+  ByteImage image1 = VolReader<ByteImage>::importVol( "benchmark-volwriter-1.vol" );
+  ByteImage image2 = VolReader<ByteImage>::importVol( "benchmark-volwriter-2.vol" );
+  ByteImage image3 = VolReader<ByteImage>::importVol( "benchmark-volwriter-3.vol" );
+  bool same = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    same = same && ( image1( *it ) == image2( *it ) )
+      && ( image1( *it ) == image3( *it ) );
+  INBLOCK_TEST( same );
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class VolWriter" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = benchmarkVolWriter();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
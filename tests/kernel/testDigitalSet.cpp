@@ -40,6 +40,9 @@
 #include <fstream>
 #include <algorithm>
 #include <string>
+#include <vector>
+#include <cstdlib>
+#include <boost/type_traits/is_same.hpp>
 
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
@@ -47,6 +50,7 @@
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
 #include "DGtal/helpers/StdDefs.h"
@@ -284,6 +288,102 @@ bool testDigitalSetConcept()
   return true;
 }
 
+/**
+ * @return 'true' iff both sets have the same points.
+ */
+template <typename Set1, typename Set2>
+bool sameSets( const Set1 & set1, const Set2 & set2 )
+{
+  if ( set1.size() != set2.size() )
+    return false;
+  for ( typename Set2::ConstIterator it = set2.begin(); it != set2.end(); ++it )
+    if ( set1.find( *it ) == set1.end() )
+      return false;
+  return true;
+}
+
+/**
+ * Compares the set operations of DigitalSetByBitset with the ones of
+ * DigitalSetBySTLSet on random sets of a 3D domain.
+ */
+bool testDigitalSetByBitset()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef Z3i::Domain Domain;
+  typedef Z3i::Point Point;
+  typedef DigitalSetByBitset<Domain> BitSet;
+  typedef DigitalSetBySTLSet<Domain> STLSet;
+
+  trace.beginBlock ( "DigitalSetByBitset vs DigitalSetBySTLSet." );
+  // 17*9*5 points: not a multiple of 64.
+  Domain domain( Point( -3, 2, 0 ), Point( 13, 10, 4 ) );
+  BitSet a( domain ), b( domain );
+  STLSet sa( domain ), sb( domain );
+  srand( 3 );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      if ( rand() % 3 == 0 ) { a.insert( *it ); sa.insert( *it ); }
+      if ( rand() % 2 == 0 ) { b.insert( *it ); sb.insert( *it ); }
+    }
+  a.erase( a.find( *sa.begin() ) );
+  sa.erase( sa.begin() );
+  INBLOCK_TEST( a.erase( domain.upperBound() + Point( 1, 1, 1 ) ) == 0 );
+  INBLOCK_TEST( a.find( domain.lowerBound() - Point( 1, 0, 0 ) ) == a.end() );
+
+  // same points, in the domain order
+  std::vector<Point> domainOrder;
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( sa.find( *it ) != sa.end() )
+      domainOrder.push_back( *it );
+  INBLOCK_TEST( ( a.size() == sa.size() )
+                && std::equal( a.begin(), a.end(), domainOrder.begin() ) );
+
+  Point la, ua, lsa, usa;
+  a.computeBoundingBox( la, ua );
+  sa.computeBoundingBox( lsa, usa );
+  INBLOCK_TEST( ( la == lsa ) && ( ua == usa ) );
+
+  BitSet u( a );
+  u += b;
+  STLSet su( sa );
+  su += sb;
+  INBLOCK_TEST( sameSets( u, su ) );
+
+  BitSet i( a );
+  i *= b;
+  unsigned int nbInter = 0;
+  bool interOk = true;
+  for ( STLSet::ConstIterator it = sa.begin(); it != sa.end(); ++it )
+    if ( sb.find( *it ) != sb.end() )
+      {
+        ++nbInter;
+        interOk = interOk && ( i.find( *it ) != i.end() );
+      }
+  INBLOCK_TEST( interOk && ( i.size() == nbInter ) );
+
+  BitSet c = a.computeComplement();
+  STLSet sc( domain );
+  sc.assignFromComplement( sa );
+  INBLOCK_TEST( sameSets( c, sc ) && ( c.size() + a.size() == 17 * 9 * 5 ) );
+
+  // Assignment from a set with another domain.
+  Domain subdomain( Point( 0, 3, 1 ), Point( 5, 6, 2 ) );
+  BitSet small( subdomain );
+  small.insert( Point( 0, 3, 1 ) );
+  small.insert( Point( 5, 6, 2 ) );
+  BitSet big( domain );
+  big = small;
+  big += small;
+  INBLOCK_TEST( ( big.size() == 2 )
+                && ( big.find( Point( 5, 6, 2 ) ) != big.end() ) );
+  trace.info() << big << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 int main()
 {
   typedef SpaceND<4> Space4Type;
@@ -310,6 +410,11 @@ int main()
   bool okSet = testDigitalSet< DigitalSetBySTLSet<Domain> >( domain );
   trace.endBlock();
 
+  trace.beginBlock( "DigitalSetByBitset" );
+  bool okBitset = testDigitalSet< DigitalSetByBitset<Domain> >( domain )
+    && testDigitalSetByBitset();
+  trace.endBlock();
+
   bool okSelectorSmall = testDigitalSetSelector
       < Domain, SMALL_DS + LOW_VAR_DS + LOW_ITER_DS + LOW_BEL_DS >
       ( domain, "Small set" );
@@ -322,14 +427,22 @@ int main()
       < Domain, MEDIUM_DS + LOW_VAR_DS + LOW_ITER_DS + HIGH_BEL_DS >
       ( domain, "Medium set + High belonging test" );
 
+  bool okSelectorBigHBel = testDigitalSetSelector
+      < Domain, BIG_DS + LOW_VAR_DS + LOW_ITER_DS + HIGH_BEL_DS >
+      ( domain, "Big set + High belonging test" )
+    && boost::is_same< DigitalSetSelector
+                       < Domain, BIG_DS + HIGH_BEL_DS >::Type,
+                       DigitalSetByBitset<Domain> >::value;
+
   bool okDigitalSetDomain = testDigitalSetDomain();
 
   bool okDigitalSetDraw = testDigitalSetDraw();
 
   bool okDigitalSetDrawSnippet = testDigitalSetBoardSnippet();
 
-  bool res = okVector && okSet
+  bool res = okVector && okSet && okBitset
       && okSelectorSmall && okSelectorBig && okSelectorMediumHBel
+      && okSelectorBigHBel
       && okDigitalSetDomain && okDigitalSetDraw && okDigitalSetDrawSnippet;
   trace.endBlock();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <cstdlib>
+#include <vector>
 #include "DGtal/base/Common.h"
 
 #include "Board/Board.h"
@@ -259,6 +261,199 @@ bool testBadKeySizes()
   return true;  
 }
 
+/**
+ * Fills a 3D hash tree with a sparse mask (random balls) using the
+ * default (chained) node storage and the open addressing one, checks
+ * that both give the same values and number of nodes, and compares
+ * their timings.
+ */
+bool testOpenAddressingStorage()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef SpaceND<3> SpaceType;
+  typedef HyperRectDomain<SpaceType> TDomain;
+  typedef TDomain::Point Point;
+  typedef experimental::ImageContainerByHashTree<TDomain, int> Image;
+  typedef experimental::ImageContainerByHashTree
+    < TDomain, int, DGtal::uint64_t,
+      experimental::OpenAddressingHashTreeStorage<int, DGtal::uint64_t> > ImageOA;
+
+  const int size = 128;
+  const unsigned int nbBalls = 40;
+  std::vector<Point> centers;
+  std::vector<int> radii;
+  srand( 0 );
+  for ( unsigned int k = 0; k < nbBalls; ++k )
+    {
+      centers.push_back( Point( rand() % size, rand() % size, rand() % size ) );
+      radii.push_back( 2 + rand() % 12 );
+    }
+
+  Image image( 10, 7, 0 );
+  ImageOA imageOA( 10, 7, 0 );
+
+  trace.beginBlock ( "SetVal (chained storage)" );
+  for ( unsigned int k = 0; k < nbBalls; ++k )
+    {
+      const Point & c = centers[ k ];
+      const int r = radii[ k ];
+      Point p;
+      for ( p[2] = c[2] - r; p[2] <= c[2] + r; ++p[2] )
+        for ( p[1] = c[1] - r; p[1] <= c[1] + r; ++p[1] )
+          for ( p[0] = c[0] - r; p[0] <= c[0] + r; ++p[0] )
+            if ( ( p[0] >= 0 ) && ( p[1] >= 0 ) && ( p[2] >= 0 )
+                 && ( p[0] < size ) && ( p[1] < size ) && ( p[2] < size )
+                 && ( ( p - c ).dot( p - c ) <= r * r ) )
+              image.setValue( p, k + 1 );
+    }
+  trace.endBlock();
+
+  trace.beginBlock ( "SetVal (open addressing storage)" );
+  for ( unsigned int k = 0; k < nbBalls; ++k )
+    {
+      const Point & c = centers[ k ];
+      const int r = radii[ k ];
+      Point p;
+      for ( p[2] = c[2] - r; p[2] <= c[2] + r; ++p[2] )
+        for ( p[1] = c[1] - r; p[1] <= c[1] + r; ++p[1] )
+          for ( p[0] = c[0] - r; p[0] <= c[0] + r; ++p[0] )
+            if ( ( p[0] >= 0 ) && ( p[1] >= 0 ) && ( p[2] >= 0 )
+                 && ( p[0] < size ) && ( p[1] < size ) && ( p[2] < size )
+                 && ( ( p - c ).dot( p - c ) <= r * r ) )
+              imageOA.setValue( p, k + 1 );
+    }
+  trace.endBlock();
+
+  trace.info() << image;
+  trace.info() << imageOA;
+  nbok += ( image.getNbNodes() == imageOA.getNbNodes() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same number of nodes" << std::endl;
+
+  unsigned int nbIterated = 0;
+  for ( ImageOA::Iterator it = imageOA.begin(); it != imageOA.end(); ++it )
+    ++nbIterated;
+  nbok += ( nbIterated == imageOA.getNbNodes() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "iterator visits all the nodes" << std::endl;
+
+  bool same = true;
+  long int sum = 0, sumOA = 0;
+  trace.beginBlock ( "GetVal (chained storage)" );
+  for ( Point p( 0, 0, 0 ); p[2] < size; ++p[2] )
+    for ( p[1] = 0; p[1] < size; ++p[1] )
+      for ( p[0] = 0; p[0] < size; ++p[0] )
+        sum += image( p );
+  trace.endBlock();
+  trace.beginBlock ( "GetVal (open addressing storage)" );
+  for ( Point p( 0, 0, 0 ); p[2] < size; ++p[2] )
+    for ( p[1] = 0; p[1] < size; ++p[1] )
+      for ( p[0] = 0; p[0] < size; ++p[0] )
+        sumOA += imageOA( p );
+  trace.endBlock();
+  for ( Point p( 0, 0, 0 ); p[2] < size; p[2] += 3 )
+    for ( p[1] = 0; p[1] < size; ++p[1] )
+      for ( p[0] = 0; p[0] < size; ++p[0] )
+        same = same && ( image( p ) == imageOA( p ) );
+  nbok += ( same && ( sum == sumOA ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same values" << std::endl;
+
+  trace.beginBlock ( "Clearing the balls (open addressing storage)" );
+  for ( unsigned int k = 0; k < nbBalls; ++k )
+    {
+      const Point & c = centers[ k ];
+      const int r = radii[ k ];
+      Point p;
+      for ( p[2] = c[2] - r; p[2] <= c[2] + r; ++p[2] )
+        for ( p[1] = c[1] - r; p[1] <= c[1] + r; ++p[1] )
+          for ( p[0] = c[0] - r; p[0] <= c[0] + r; ++p[0] )
+            if ( ( p[0] >= 0 ) && ( p[1] >= 0 ) && ( p[2] >= 0 )
+                 && ( p[0] < size ) && ( p[1] < size ) && ( p[2] < size ) )
+              imageOA.setValue( p, 0 );
+    }
+  trace.endBlock();
+  trace.info() << imageOA;
+  nbok += ( imageOA.getNbNodes() == 1 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "back to the root node only" << std::endl;
+
+  return nbok == nb;
+}
+
+/**
+ * Builds a 3D hash tree from a dense image with buildFromImage and
+ * compares it to the tree obtained with setValue on each point.
+ */
+bool testBuildFromImage()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef SpaceND<3> SpaceType;
+  typedef HyperRectDomain<SpaceType> TDomain;
+  typedef TDomain::Point Point;
+  typedef experimental::ImageContainerByHashTree<TDomain, int> Image;
+  typedef ImageContainerBySTLVector<TDomain, int> ImageVector;
+
+  // the image domain is strictly included in the tree span
+  const int size = 100;
+  ImageVector dense( Point( 0, 0, 0 ), Point( size - 1, size - 1, size - 1 ) );
+  srand( 0 );
+  for ( unsigned int k = 0; k < 30; ++k )
+    {
+      const Point c( rand() % size, rand() % size, rand() % size );
+      const int r = 2 + rand() % 15;
+      Point p;
+      for ( p[2] = c[2] - r; p[2] <= c[2] + r; ++p[2] )
+        for ( p[1] = c[1] - r; p[1] <= c[1] + r; ++p[1] )
+          for ( p[0] = c[0] - r; p[0] <= c[0] + r; ++p[0] )
+            if ( dense.domain().isInside( p )
+                 && ( ( p - c ).dot( p - c ) <= r * r ) )
+              dense.setValue( p, k + 1 );
+    }
+
+  Image image( 10, 7, -1 );
+  trace.beginBlock ( "SetVal on each point" );
+  for ( Point p( 0, 0, 0 ); p[2] < size; ++p[2] )
+    for ( p[1] = 0; p[1] < size; ++p[1] )
+      for ( p[0] = 0; p[0] < size; ++p[0] )
+        image.setValue( p, dense( p ) );
+  trace.endBlock();
+
+  Image bulk( 10, 7, 5 );
+  bulk.setValue( Point( 3, 4, 5 ), 12 );
+  trace.beginBlock ( "buildFromImage" );
+  bulk.buildFromImage( dense, -1 );
+  trace.endBlock();
+
+  trace.info() << image;
+  trace.info() << bulk;
+  nbok += ( image.getNbNodes() == bulk.getNbNodes() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same number of nodes" << std::endl;
+
+  bool same = true;
+  const int span = bulk.getSpanSize();
+  for ( Point p( 0, 0, 0 ); p[2] < span; p[2] += 3 )
+    for ( p[1] = 0; p[1] < span; ++p[1] )
+      for ( p[0] = 0; p[0] < span; ++p[0] )
+        same = same && ( bulk( p ) == image( p ) );
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same values" << std::endl;
+
+  return nbok == nb;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -270,7 +465,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testHashTree() && testGetSetVal() && testBadKeySizes();  // && ... other tests
+  bool res = testHashTree() && testGetSetVal() && testBadKeySizes()
+    && testOpenAddressingStorage() && testBuildFromImage();  // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <cstdlib>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/images/Morton.h"
@@ -120,6 +122,87 @@ bool testMorton()
   return nbok == nb;
 }
 
+/**
+ * Compares the dimension-specialized interleaving/deinterleaving
+ * with the generic bit per bit one on random points, and benchmarks
+ * both.
+ *
+ * @tparam Point the point type.
+ * @tparam HashKey the key type.
+ * @param treeDepth depth used to build the keys (coordinates are
+ * taken in [0,2^treeDepth[).
+ */
+template <typename Point, typename HashKey>
+bool testMortonCodec( const unsigned int treeDepth )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  const unsigned int nbPoints = 1000000;
+
+  trace.beginBlock ( "Testing specialized Morton codes ..." );
+  trace.info() << "dimension=" << Point::dimension
+               << " sizeof(HashKey)=" << sizeof(HashKey)
+               << " treeDepth=" << treeDepth << endl;
+
+  Morton<HashKey,Point> morton;
+  std::vector<Point> points( nbPoints );
+  srand( 0 );
+  for ( unsigned int k = 0; k < nbPoints; ++k )
+    for ( Dimension i = 0; i < Point::dimension; ++i )
+      {
+        DGtal::uint64_t r = 0;
+        for ( unsigned int j = 0; j < 4; ++j )
+          r = ( r << 16 ) ^ static_cast<DGtal::uint64_t>( rand() );
+        points[ k ][ i ] = r
+          & ( ( static_cast<DGtal::uint64_t>( 1 ) << treeDepth ) - 1 );
+      }
+
+  bool same = true;
+  for ( unsigned int k = 0; k < 10000; ++k )
+    {
+      HashKey h, hgen;
+      Point p, pgen;
+      morton.interleaveBits( points[ k ], h );
+      morton.interleaveBitsGeneric( points[ k ], hgen );
+      HashKey key = morton.keyFromCoordinates( treeDepth, points[ k ] );
+      morton.coordinatesFromKey( key, p );
+      morton.coordinatesFromKeyGeneric( key, pgen );
+      same = same && ( h == hgen ) && ( p == pgen ) && ( p == points[ k ] );
+    }
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "specialized == generic" << std::endl;
+
+  HashKey sum = 0, sumGeneric = 0;
+  Point p;
+  trace.beginBlock ( "Generic interleaveBits + coordinatesFromKey" );
+  for ( unsigned int k = 0; k < nbPoints; ++k )
+    {
+      HashKey h;
+      morton.interleaveBitsGeneric( points[ k ], h );
+      morton.coordinatesFromKeyGeneric( h, p );
+      sumGeneric += h + static_cast<HashKey>( p[ 0 ] );
+    }
+  trace.endBlock();
+  trace.beginBlock ( "Specialized interleaveBits + coordinatesFromKey" );
+  for ( unsigned int k = 0; k < nbPoints; ++k )
+    {
+      HashKey h;
+      morton.interleaveBits( points[ k ], h );
+      morton.coordinatesFromKey( h, p );
+      sum += h + static_cast<HashKey>( p[ 0 ] );
+    }
+  trace.endBlock();
+  nbok += ( sum == sumGeneric ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same checksums" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -131,7 +214,11 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMorton(); // && ... other tests
+  bool res = testMorton()
+    && testMortonCodec<PointVector<2,DGtal::int32_t>, DGtal::uint64_t>( 31 )
+    && testMortonCodec<PointVector<3,DGtal::int32_t>, DGtal::uint64_t>( 20 )
+    && testMortonCodec<PointVector<2,DGtal::int32_t>, DGtal::uint32_t>( 15 )
+    && testMortonCodec<PointVector<3,DGtal::int64_t>, DGtal::uint32_t>( 10 ); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -33,6 +33,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/topology/MetricAdjacency.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/helpers/StdDefs.h"
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -165,6 +166,99 @@ bool testMetricAdjacency()
   return nbok == nb;
 }
 
+/**
+ * Checks the table of NeighborhoodOffsets against the enumeration of
+ * [-1,1]^n, and its linearized version against the linear indices of
+ * the points of a domain.
+ */
+template <typename TSpace, Dimension maxNorm1>
+bool testNeighborhoodOffsets( const unsigned int expectedSize )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef typename TSpace::Point Point;
+  typedef typename TSpace::Vector Vector;
+  typedef HyperRectDomain<TSpace> Domain;
+  typedef MetricAdjacency<TSpace, maxNorm1> Adjacency;
+  typedef typename Adjacency::Offsets Offsets;
+
+  trace.beginBlock ( "Testing neighborhood offsets" );
+  Offsets::selfDisplay( trace.info() );
+  trace.info() << std::endl;
+  nbok += Offsets::size == expectedSize ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "size=" << Offsets::size << " == " << expectedSize
+         << " ?" << std::endl;
+
+  // Same neighbors, in the same order, as an enumeration of the
+  // 3^n points around p.
+  Point p = Point::diagonal( 7 );
+  p[ 0 ] = -3;
+  Domain local( p - Point::diagonal( 1 ), p + Point::diagonal( 1 ) );
+  vector<Point> expected;
+  for ( typename Domain::ConstIterator it = local.begin();
+  it != local.end(); ++it )
+    if ( Adjacency::isProperlyAdjacentTo( p, *it ) )
+      expected.push_back( *it );
+  vector<Point> neigh;
+  back_insert_iterator< vector<Point> > bii( neigh );
+  Adjacency::writeProperNeighborhood( p, bii );
+  nbok += neigh == expected ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "writeProperNeighborhood == enumeration ?" << std::endl;
+
+  vector<Point> full;
+  back_insert_iterator< vector<Point> > biif( full );
+  Adjacency::writeNeighborhood( p, biif );
+  bool symmetric = ( full.size() == Offsets::size + 1 )
+    && ( full[ Offsets::size / 2 ] == p );
+  for ( unsigned int i = 0; i < Offsets::size; ++i )
+    symmetric = symmetric
+      && ( Offsets::offset( i ) + Offsets::offset( Offsets::size - 1 - i )
+           == Vector::zero );
+  nbok += symmetric ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "symmetric table, p in the middle of writeNeighborhood ?"
+         << std::endl;
+
+  // Linear indices in a small domain, at every point (border included).
+  Domain domain( Point::diagonal( -2 ), Point::diagonal( 2 ) );
+  Vector extent = domain.upperBound() - domain.lowerBound()
+    + Vector::diagonal( 1 );
+  vector<long int> linearOffsets;
+  back_insert_iterator< vector<long int> > biio( linearOffsets );
+  Offsets::writeLinearOffsets( extent, biio );
+  vector<Point> points( domain.begin(), domain.end() );
+  bool linearOk = true;
+  for ( unsigned int i = 0; i < points.size(); ++i )
+    {
+      vector<long int> indices;
+      back_insert_iterator< vector<long int> > bii2( indices );
+      Offsets::writeLinearNeighborhood( points[ i ], i,
+          domain.lowerBound(), domain.upperBound(),
+          &linearOffsets[ 0 ], bii2 );
+      vector<Point> inDomain;
+      for ( const Vector* it = Offsets::begin(); it != Offsets::end(); ++it )
+  if ( domain.isInside( points[ i ] + *it ) )
+    inDomain.push_back( points[ i ] + *it );
+      linearOk = linearOk && ( indices.size() == inDomain.size() );
+      for ( unsigned int j = 0; linearOk && ( j < indices.size() ); ++j )
+  linearOk = points[ indices[ j ] ] == inDomain[ j ];
+    }
+  nbok += linearOk ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "writeLinearNeighborhood == neighbors in the domain ?"
+         << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -176,7 +270,13 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMetricAdjacency(); // && ... other tests
+  bool res = testMetricAdjacency()
+    && testNeighborhoodOffsets<Z2i::Space, 1>( 4 )
+    && testNeighborhoodOffsets<Z2i::Space, 2>( 8 )
+    && testNeighborhoodOffsets<Z3i::Space, 1>( 6 )
+    && testNeighborhoodOffsets<Z3i::Space, 2>( 18 )
+    && testNeighborhoodOffsets<Z3i::Space, 3>( 26 )
+    && testNeighborhoodOffsets<SpaceND<4>, 2>( 32 ); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,234 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBoundaryExtractor.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/05/13
+ *
+ * Functions for testing class BoundaryExtractor.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/kernel/sets/SetPredicate.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/helpers/BoundaryExtractor.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BoundaryExtractor.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Components computed as Surfaces::extractAllConnectedSCell did
+ * before, with a set of all the boundary surfels.
+ */
+template <typename KSpace, typename PointPredicate>
+void referenceComponents( std::vector< std::vector<typename KSpace::SCell> > & result,
+                          const KSpace & K,
+                          const SurfelAdjacency<KSpace::dimension> & SAdj,
+                          const PointPredicate & pp )
+{
+  typedef typename KSpace::Cell Cell;
+  typedef typename KSpace::SCell SCell;
+  std::set<SCell> bdry;
+  Cell low = K.uFirst( K.uSpel( K.lowerBound() ) );
+  Cell upp = K.uLast( K.uSpel( K.upperBound() ) );
+  Surfaces<KSpace>::sMakeBoundary( bdry, K, pp, low, upp );
+  result.clear();
+  while ( ! bdry.empty() )
+    {
+      std::set<SCell> component;
+      Surfaces<KSpace>::trackBoundary( component, K, SAdj, pp, *bdry.begin() );
+      for ( typename std::set<SCell>::const_iterator it = component.begin();
+            it != component.end(); ++it )
+        bdry.erase( *it );
+      result.push_back( std::vector<SCell>( component.begin(), component.end() ) );
+    }
+}
+
+/**
+ * Compares the extraction with the set-based one on a random shape
+ * (a union of balls plus noise) for both interior and exterior
+ * surfel adjacencies.
+ */
+template <typename KSpace>
+bool testBoundaryExtractor( const typename KSpace::Point & low,
+                            const typename KSpace::Point & high,
+                            unsigned int nbBalls )
+{
+  typedef typename KSpace::Space Space;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::SCell SCell;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+  typedef std::vector< std::vector<SCell> > Components;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing BoundaryExtractor in dimension ..." );
+  trace.info() << "dimension=" << KSpace::dimension << endl;
+  KSpace K;
+  K.init( low, high, true );
+  Domain domain( low, high );
+  DigitalSet shape( domain );
+  srand( 7 );
+  std::vector<Point> centers;
+  for ( unsigned int i = 0; i < nbBalls; ++i )
+    {
+      Point c;
+      for ( Dimension k = 0; k < KSpace::dimension; ++k )
+        c[ k ] = low[ k ] + rand() % ( high[ k ] - low[ k ] + 1 );
+      centers.push_back( c );
+    }
+  for ( typename Domain::ConstIterator it = domain.begin();
+        it != domain.end(); ++it )
+    {
+      bool in = ( rand() % 23 ) == 0;
+      for ( unsigned int i = 0; ( i < centers.size() ) && ! in; ++i )
+        in = ( *it - centers[ i ] ).norm() <= 3.0;
+      if ( in ) shape.insert( *it );
+    }
+  SetPredicate<DigitalSet> pp( shape );
+
+  for ( unsigned int i = 0; i < 2; ++i )
+    {
+      SurfelAdjacency<KSpace::dimension> SAdj( i == 0 );
+      Components ref, comps;
+      referenceComponents( ref, K, SAdj, pp );
+      Surfaces<KSpace>::extractAllConnectedSCell( comps, K, SAdj, pp );
+      BoundaryExtractor<KSpace> extractor( K, SAdj );
+      extractor.extract( pp );
+      unsigned int nbSurfels = 0;
+      for ( unsigned int c = 0; c < ref.size(); ++c )
+        nbSurfels += ref[ c ].size();
+      trace.info() << extractor << " reference: " << ref.size()
+                   << " components, " << nbSurfels << " surfels" << endl;
+      nbok += extractor.isValid() ? 1 : 0;
+      nb++;
+      nbok += ( extractor.nbComponents() == ref.size()
+                && extractor.nbSurfels() == nbSurfels ) ? 1 : 0;
+      nb++;
+      nbok += ( comps == ref ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "extractAllConnectedSCell == reference, interior="
+                   << ( i == 0 ) << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks that 2D contours are the ones tracked from a set of all the
+ * boundary surfels.
+ */
+bool testContours2D()
+{
+  typedef KhalimskySpaceND<2> KSpace;
+  typedef KSpace::Space Space;
+  typedef KSpace::Point Point;
+  typedef KSpace::SCell SCell;
+  typedef HyperRectDomain<Space> Domain;
+  typedef DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing extractAll2DSCellContours ..." );
+  Point low( -10, -8 );
+  Point high( 12, 9 );
+  KSpace K;
+  K.init( low, high, true );
+  Domain domain( low, high );
+  DigitalSet shape( domain );
+  srand( 11 );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( ( rand() % 3 ) == 0 ) shape.insert( *it );
+  SetPredicate<DigitalSet> pp( shape );
+  for ( unsigned int i = 0; i < 2; ++i )
+    {
+      SurfelAdjacency<2> SAdj( i == 0 );
+      std::vector< std::vector<SCell> > contours, ref;
+      Surfaces<KSpace>::extractAll2DSCellContours( contours, K, SAdj, pp );
+      std::set<SCell> bdry;
+      Surfaces<KSpace>::sMakeBoundary( bdry, K, pp,
+                                       K.uFirst( K.uSpel( low ) ),
+                                       K.uLast( K.uSpel( high ) ) );
+      while ( ! bdry.empty() )
+        {
+          std::vector<SCell> contour;
+          Surfaces<KSpace>::track2DBoundary( contour, K, SAdj, pp, *bdry.begin() );
+          for ( unsigned int j = 0; j < contour.size(); ++j )
+            bdry.erase( contour[ j ] );
+          ref.push_back( contour );
+        }
+      trace.info() << contours.size() << " contours, reference "
+                   << ref.size() << endl;
+      nbok += ( contours == ref ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "contours == reference, interior=" << ( i == 0 )
+                   << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class BoundaryExtractor" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  typedef KhalimskySpaceND<2> K2;
+  typedef KhalimskySpaceND<3> K3;
+  typedef KhalimskySpaceND<4> K4;
+  bool res = testBoundaryExtractor<K2>( K2::Point( -20, -15 ),
+                                        K2::Point( 25, 17 ), 6 )
+    && testBoundaryExtractor<K3>( K3::Point( -8, -7, -6 ),
+                                  K3::Point( 9, 8, 7 ), 5 )
+    && testBoundaryExtractor<K4>( K4::Point( -3, -3, -2, -2 ),
+                                  K4::Point( 3, 4, 2, 3 ), 3 )
+    && testContours2D();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,144 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCellHashSet-benchmark.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/05/16
+ *
+ * Benchmark of surface tracking with CellHashSet against std::set.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/CellHashSet.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+         << #x << std::endl;
+
+typedef KhalimskySpaceND<3> KSpace;
+typedef KSpace::Point Point;
+typedef KSpace::Cell Cell;
+typedef KSpace::SCell SCell;
+
+/**
+ * Euclidean ball predicate.
+ */
+struct BallPredicate
+{
+  typedef KSpace::Point Point;
+  BallPredicate( const Point & c, const double r )
+    : myCenter( c ), myRadius2( r * r )
+  {}
+  bool operator()( const Point & p ) const
+  {
+    double d2 = 0.0;
+    for ( Dimension k = 0; k < Point::dimension; ++k )
+      d2 += (double) ( p[ k ] - myCenter[ k ] ) * ( p[ k ] - myCenter[ k ] );
+    return d2 <= myRadius2;
+  }
+  Point myCenter;
+  double myRadius2;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class CellHashSet.
+///////////////////////////////////////////////////////////////////////////////
+
+bool benchmarkTracking()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  Point low( -128, -128, -128 );
+  Point high( 127, 127, 127 );
+  KSpace K;
+  K.init( low, high, true );
+  BallPredicate ball( Point( 0, 0, 0 ), 120.0 );
+  SurfelAdjacency<3> SAdj( true );
+  SCell bel = Surfaces<KSpace>::findABel( K, ball, Point( 0, 0, 0 ), high );
+
+  std::set<SCell> sSurface;
+  trace.beginBlock ( "Tracking a ball surface in 256^3 with std::set ..." );
+  Surfaces<KSpace>::trackBoundary( sSurface, K, SAdj, ball, bel );
+  trace.info() << sSurface.size() << " surfels" << endl;
+  trace.endBlock();
+
+  CellHashSet<KSpace> hSurface( K );
+  trace.beginBlock ( "Tracking a ball surface in 256^3 with CellHashSet ..." );
+  Surfaces<KSpace>::trackBoundary( hSurface, K, SAdj, ball, bel );
+  trace.info() << hSurface << endl;
+  trace.endBlock();
+  INBLOCK_TEST( sSurface.size() == hSurface.size() );
+
+  std::set<SCell> sClosed;
+  trace.beginBlock ( "Closed tracking with std::set ..." );
+  Surfaces<KSpace>::trackClosedBoundary( sClosed, K, SAdj, ball, bel );
+  trace.endBlock();
+  trace.beginBlock ( "Closed tracking with CellHashSet ..." );
+  Surfaces<KSpace>::trackClosedBoundary( hSurface, K, SAdj, ball, bel );
+  trace.endBlock();
+  INBLOCK_TEST( sClosed.size() == hSurface.size() );
+
+  std::set<Cell> sBdry;
+  CellHashSet<KSpace, Cell> hBdry( K );
+  Cell first = K.uFirst( K.uSpel( low ) );
+  Cell last = K.uLast( K.uSpel( high ) );
+  trace.beginBlock ( "uMakeBoundary with std::set ..." );
+  Surfaces<KSpace>::uMakeBoundary( sBdry, K, ball, first, last );
+  trace.endBlock();
+  trace.beginBlock ( "uMakeBoundary with CellHashSet ..." );
+  Surfaces<KSpace>::uMakeBoundary( hBdry, K, ball, first, last );
+  trace.endBlock();
+  INBLOCK_TEST( sBdry.size() == hBdry.size() );
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class CellHashSet" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = benchmarkTracking();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,237 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCellHashSet.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/05/16
+ *
+ * Functions for testing classes KhalimskyCellHash, CellHashSet and
+ * CellHashMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <map>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/kernel/sets/SetPredicate.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/KhalimskyCellHash.h"
+#include "DGtal/topology/CellHashSet.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+         << #x << std::endl;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CellHashSet.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Checks that the packed keys of all the signed cells of a small
+ * space are distinct, and that an unbounded space is not packed.
+ */
+bool testKhalimskyCellHash()
+{
+  typedef KhalimskySpaceND<3> KSpace;
+  typedef KSpace::Point Point;
+  typedef KSpace::Cell Cell;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing KhalimskyCellHash ..." );
+  KSpace K;
+  K.init( Point( -3, -2, 0 ), Point( 4, 2, 5 ), true );
+  KhalimskyCellHash<KSpace> hash( K );
+  trace.info() << hash << endl;
+  INBLOCK_TEST( hash.isPacked() );
+  std::set<KhalimskyCellHash<KSpace>::Key> keys;
+  unsigned int nbCells = 0;
+  Cell first = K.uFirst( K.uSpel( K.lowerBound() ) );
+  Cell last = K.uLast( K.uSpel( K.upperBound() ) );
+  Cell c = first;
+  do
+    {
+      ++nbCells;
+      keys.insert( hash.key( c ) );
+      keys.insert( hash.key( K.signs( c, K.POS ) ) );
+      keys.insert( hash.key( K.signs( c, K.NEG ) ) );
+    }
+  while ( K.uNext( c, first, last ) );
+  trace.info() << nbCells << " cells, " << keys.size() << " keys" << endl;
+  // Unsigned cells and positive signed cells share their keys.
+  INBLOCK_TEST( keys.size() == 2 * nbCells );
+  INBLOCK_TEST( hash( K.sSpel( Point( 1, 1, 1 ) ) )
+                == hash( K.sSpel( Point( 1, 1, 1 ) ) ) );
+
+  KSpace Kinf;
+  KhalimskyCellHash<KSpace> hashInf( Kinf );
+  INBLOCK_TEST( ! hashInf.isPacked() );
+  INBLOCK_TEST( hashInf.key( Kinf.sSpel( Point( 1, 1, 1 ), K.POS ) )
+                != hashInf.key( Kinf.sSpel( Point( 1, 1, 1 ), K.NEG ) ) );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Random insertions and deletions compared with std::set and
+ * std::map, in a packed and an unbounded space.
+ */
+template <typename KSpace>
+bool testCellHashSet( const KSpace & K, const string & name )
+{
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::SCell SCell;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing CellHashSet and CellHashMap in " + name );
+  CellHashSet<KSpace> hset( K );
+  CellHashMap<KSpace, int> hmap( K );
+  std::set<SCell> sset;
+  std::map<SCell, int> smap;
+  srand( 3 );
+  bool same = true;
+  for ( unsigned int i = 0; i < 20000; ++i )
+    {
+      Point p( rand() % 16 - 8, rand() % 16 - 8, rand() % 16 - 8 );
+      SCell c = K.sSpel( p, ( rand() % 2 ) == 0 );
+      if ( ( rand() % 3 ) == 0 )
+        {
+          same = same && ( hset.erase( c ) == sset.erase( c ) );
+          same = same && ( hmap.erase( c ) == smap.erase( c ) );
+        }
+      else
+        {
+          same = same && ( hset.insert( c ).second == sset.insert( c ).second );
+          hmap[ c ] += i;
+          smap[ c ] += i;
+        }
+    }
+  INBLOCK_TEST( same );
+  INBLOCK_TEST( hset.isValid() && hmap.isValid() );
+  trace.info() << hset << endl;
+  INBLOCK_TEST( hset.size() == sset.size() && hmap.size() == smap.size() );
+  unsigned int nbFound = 0;
+  for ( typename std::set<SCell>::const_iterator it = sset.begin();
+        it != sset.end(); ++it )
+    nbFound += ( hset.find( *it ) != hset.end() ) ? 1 : 0;
+  std::set<SCell> sset2( hset.begin(), hset.end() );
+  INBLOCK_TEST( nbFound == sset.size() && sset2 == sset );
+  bool sameValues = true;
+  for ( typename CellHashMap<KSpace, int>::ConstIterator it = hmap.begin();
+        it != hmap.end(); ++it )
+    sameValues = sameValues && ( smap[ it->first ] == it->second );
+  INBLOCK_TEST( sameValues && smap.size() == hmap.size() );
+  hset.clear();
+  INBLOCK_TEST( hset.empty() && hset.begin() == hset.end() );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Surface tracking with a CellHashSet gives the same surfels as with
+ * a std::set.
+ */
+bool testTracking()
+{
+  typedef KhalimskySpaceND<3> KSpace;
+  typedef KSpace::Space Space;
+  typedef KSpace::Point Point;
+  typedef KSpace::Cell Cell;
+  typedef KSpace::SCell SCell;
+  typedef HyperRectDomain<Space> Domain;
+  typedef DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing surface tracking with CellHashSet ..." );
+  Point low( -12, -12, -12 );
+  Point high( 12, 12, 12 );
+  KSpace K;
+  K.init( low, high, true );
+  Domain domain( low, high );
+  DigitalSet ball( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( (*it).norm() <= 9.5 ) ball.insert( *it );
+  SetPredicate<DigitalSet> pp( ball );
+  SurfelAdjacency<3> SAdj( true );
+  SCell bel = Surfaces<KSpace>::findABel( K, pp, Point( 0, 0, 0 ), Point( 12, 0, 0 ) );
+
+  std::set<SCell> sSurface;
+  CellHashSet<KSpace> hSurface( K );
+  Surfaces<KSpace>::trackBoundary( sSurface, K, SAdj, pp, bel );
+  Surfaces<KSpace>::trackBoundary( hSurface, K, SAdj, pp, bel );
+  INBLOCK_TEST( sSurface == std::set<SCell>( hSurface.begin(), hSurface.end() ) );
+  Surfaces<KSpace>::trackClosedBoundary( hSurface, K, SAdj, pp, bel );
+  INBLOCK_TEST( sSurface.size() == hSurface.size() );
+
+  std::set<Cell> sBdry;
+  CellHashSet<KSpace, Cell> hBdry( K );
+  Cell first = K.uFirst( K.uSpel( low ) );
+  Cell last = K.uLast( K.uSpel( high ) );
+  Surfaces<KSpace>::uMakeBoundary( sBdry, K, pp, first, last );
+  Surfaces<KSpace>::uMakeBoundary( hBdry, K, pp, first, last );
+  trace.info() << sBdry.size() << " surfels, " << hBdry << endl;
+  INBLOCK_TEST( sBdry == std::set<Cell>( hBdry.begin(), hBdry.end() ) );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class CellHashSet" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  typedef KhalimskySpaceND<3> KSpace;
+  KSpace K;
+  K.init( KSpace::Point( -10, -10, -10 ), KSpace::Point( 10, 10, 10 ), true );
+  KSpace Kinf;
+  bool res = testKhalimskyCellHash()
+    && testCellHashSet( K, "a bounded space" )
+    && testCellHashSet( Kinf, "an unbounded space" )
+    && testTracking();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,198 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConnectedComponentLabelling.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/05/10
+ *
+ * Functions for testing class ConnectedComponentLabelling.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConnectedComponentLabelling.
+///////////////////////////////////////////////////////////////////////////////
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+         << #x << std::endl;
+
+/**
+ * Small 2D image with a known number of 4- and 8-components.
+ */
+bool testLabelling2D()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Labelling a 2D image ..." );
+  typedef ImageContainerBySTLVector<Z2i::Domain, int> Image;
+  typedef ConnectedComponentLabelling<Image> CCL;
+
+  // 1 0 1 0
+  // 0 1 1 0
+  // 0 0 0 1
+  const int values[] = { 1, 0, 1, 0,
+                         0, 1, 1, 0,
+                         0, 0, 0, 1 };
+  Image image( Z2i::Point( 0, 0 ), Z2i::Point( 3, 2 ) );
+  for ( unsigned int i = 0; i < 12; ++i )
+    image.setValue( Z2i::Point( i % 4, 2 - i / 4 ), values[ i ] );
+
+  CCL ccl4( 1 );
+  CCL::LabelImage labels4 = ccl4.compute( image );
+  trace.info() << ccl4 << std::endl;
+  // 4-connectivity: 3 components of 1 and 3 components of 0
+  INBLOCK_TEST( ccl4.nbComponents() == 6 );
+
+  CCL ccl8( 2 );
+  CCL::LabelImage labels8 = ccl8.compute( image );
+  trace.info() << ccl8 << std::endl;
+  // 8-connectivity: one component of 1 and one component of 0
+  INBLOCK_TEST( ccl8.nbComponents() == 2 );
+  INBLOCK_TEST( labels8( Z2i::Point( 0, 2 ) ) == labels8( Z2i::Point( 3, 0 ) ) );
+  INBLOCK_TEST( labels8( Z2i::Point( 1, 2 ) ) == labels8( Z2i::Point( 3, 1 ) ) );
+  INBLOCK_TEST( labels8( Z2i::Point( 1, 2 ) ) != labels8( Z2i::Point( 0, 2 ) ) );
+
+  CCL::Size total = 0;
+  for ( CCL::Label l = 0; l < ccl4.nbComponents(); ++l )
+    total += ccl4.componentSizes()[ l ];
+  INBLOCK_TEST( total == 12 );
+  INBLOCK_TEST( labels4( Z2i::Point( 0, 0 ) ) == 0 );
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Random 3D binary image: the number of components of value 1 must
+ * be the number of connected components of the corresponding Object,
+ * and the multithreaded labelling must give the same labels.
+ */
+template <typename TObject>
+bool testLabelling3D( const typename TObject::DigitalTopology & topology,
+                      const Dimension maxNorm1 )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Labelling a random 3D image ..." );
+  trace.info() << "maxNorm1=" << maxNorm1 << std::endl;
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  typedef ConnectedComponentLabelling<Image> CCL;
+
+  Z3i::Domain domain( Z3i::Point( -5, 0, 2 ), Z3i::Point( 24, 19, 31 ) );
+  Image image( domain.lowerBound(), domain.upperBound() );
+  Z3i::DigitalSet set( domain );
+  srand( 0 );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( rand() % 100 < 25 )
+      {
+        image.setValue( *it, 1 );
+        set.insertNew( *it );
+      }
+    else
+      image.setValue( *it, 0 );
+
+  CCL ccl( maxNorm1 );
+  CCL::LabelImage labels = ccl.compute( image );
+  trace.info() << ccl << std::endl;
+
+  std::vector<bool> foreground( ccl.nbComponents(), false );
+  unsigned int nbForeground = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( ( image( *it ) == 1 ) && ( ! foreground[ labels( *it ) ] ) )
+      {
+        foreground[ labels( *it ) ] = true;
+        ++nbForeground;
+      }
+
+  TObject object( topology, set );
+  std::vector<TObject> components;
+  back_insert_iterator< std::vector<TObject> > inserter( components );
+  unsigned int nbObjectComponents = object.writeComponents( inserter );
+  trace.info() << nbForeground << " foreground components, Object: "
+               << nbObjectComponents << std::endl;
+  INBLOCK_TEST( nbForeground == nbObjectComponents );
+
+  // each Object component has a single label and its size
+  bool sameComponents = true;
+  for ( unsigned int c = 0; c < components.size(); ++c )
+    {
+      const CCL::Label l = labels( *components[ c ].pointSet().begin() );
+      sameComponents = sameComponents
+        && ( ccl.componentSizes()[ l ] == components[ c ].size() );
+      for ( typename TObject::DigitalSet::ConstIterator it = components[ c ].pointSet().begin();
+            it != components[ c ].pointSet().end(); ++it )
+        sameComponents = sameComponents && ( labels( *it ) == l );
+    }
+  INBLOCK_TEST( sameComponents );
+
+  CCL cclParallel( maxNorm1 );
+  cclParallel.setNumberOfThreads( 4 );
+  CCL::LabelImage labelsParallel = cclParallel.compute( image );
+  bool same = ( cclParallel.nbComponents() == ccl.nbComponents() );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    same = same && ( labels( *it ) == labelsParallel( *it ) );
+  INBLOCK_TEST( same );
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ConnectedComponentLabelling" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testLabelling2D()
+    && testLabelling3D<Z3i::Object6_18>( Z3i::dt6_18, 1 )
+    && testLabelling3D<Z3i::Object18_6>( Z3i::dt18_6, 2 )
+    && testLabelling3D<Z3i::Object26_6>( Z3i::dt26_6, 3 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,195 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDenseExpander.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/06/01
+ *
+ * Functions for testing class DenseExpander.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/DomainAdjacency.h"
+#include "DGtal/topology/DigitalTopology.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/topology/Expander.h"
+#include "DGtal/topology/DenseExpander.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DenseExpander.
+///////////////////////////////////////////////////////////////////////////////
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+         << #x << std::endl;
+
+/**
+ * Runs both expanders in parallel and checks that they give the same
+ * layers at the same distances, and the same cores.
+ */
+template <typename TObject>
+bool sameLayers( Expander<TObject> & expander,
+                 DenseExpander<TObject> & denseExpander )
+{
+  typedef typename TObject::Point Point;
+  bool same = true;
+  while ( same )
+    {
+      std::vector<Point> layer( expander.begin(), expander.end() );
+      std::vector<Point> denseLayer( denseExpander.begin(),
+                                     denseExpander.end() );
+      std::sort( denseLayer.begin(), denseLayer.end() );
+      std::sort( layer.begin(), layer.end() );
+      same = ( expander.finished() == denseExpander.finished() )
+        && ( expander.distance() == denseExpander.distance() )
+        && ( expander.core().size() == denseExpander.coreSize() )
+        && ( layer == denseLayer );
+      for ( typename TObject::DigitalSet::ConstIterator
+              it = expander.core().begin(), itEnd = expander.core().end();
+            ( it != itEnd ) && same; ++it )
+        same = denseExpander.inCore( *it );
+      if ( expander.finished() )
+        break;
+      expander.nextLayer();
+      denseExpander.nextLayer();
+    }
+  trace.info() << expander << " " << denseExpander << endl;
+  return same;
+}
+
+/**
+ * Expansion in a 2D object with holes, from a point and from several
+ * points.
+ */
+bool testDenseExpander2D()
+{
+  typedef Z2i::Point Point;
+  typedef Z2i::Domain Domain;
+  typedef Z2i::Object4_8 ObjectType;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing 2D dense expansion ..." );
+  Domain domain( Point( -12, -12 ), Point( 12, 12 ) );
+  Z2i::DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point( 0, 0 ), 12 );
+  Shapes<Domain>::removeNorm1Ball( shape_set, Point( 3, 2 ), 3 );
+  Shapes<Domain>::removeNorm2Ball( shape_set, Point( -5, -4 ), 2 );
+  ObjectType shape( Z2i::dt4_8, shape_set );
+  Z2i::Object8_4 shape8( Z2i::dt8_4, shape_set );
+
+  Expander<ObjectType> expander( shape, Point( 0, -9 ) );
+  DenseExpander<ObjectType> denseExpander( shape, Point( 0, -9 ) );
+  INBLOCK_TEST( denseExpander.isValid() );
+  INBLOCK_TEST( sameLayers( expander, denseExpander ) );
+  INBLOCK_TEST( denseExpander.coreSize() == shape.size() );
+
+  std::vector<Point> seeds;
+  seeds.push_back( Point( -12, 0 ) );
+  seeds.push_back( Point( 12, 0 ) );
+  seeds.push_back( Point( 0, 12 ) );
+  Expander<Z2i::Object8_4> expander2( shape8, seeds.begin(), seeds.end() );
+  DenseExpander<Z2i::Object8_4> denseExpander2( shape8, seeds.begin(),
+                                                seeds.end() );
+  INBLOCK_TEST( sameLayers( expander2, denseExpander2 ) );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Expansion in a 3D object whose adjacencies are restricted to the
+ * domain, with a tunnel and two components.
+ */
+bool testDenseExpander3D()
+{
+  typedef Z3i::Space Space;
+  typedef Z3i::Point Point;
+  typedef Z3i::Domain Domain;
+  typedef MetricAdjacency< Space, 1 > MetricAdj6;
+  typedef MetricAdjacency< Space, 2 > MetricAdj18;
+  typedef DomainAdjacency< Domain, MetricAdj6 > Adj6;
+  typedef DomainAdjacency< Domain, MetricAdj18 > Adj18;
+  typedef DigitalTopology< Adj18, Adj6 > DT18_6;
+  typedef Object< DT18_6, Z3i::DigitalSet > ObjectType;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing 3D dense expansion ..." );
+  Domain domain( Point( -10, -10, -10 ), Point( 10, 10, 10 ) );
+  MetricAdj6 madj6;
+  MetricAdj18 madj18;
+  Adj6 adj6( domain, madj6 );
+  Adj18 adj18( domain, madj18 );
+  DT18_6 dt18_6( adj18, adj6, JORDAN_DT );
+  Z3i::DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point( 0, 0, 0 ), 10 );
+  for ( int z = -10; z <= 10; ++z )
+    for ( int y = -1; y <= 1; ++y )
+      for ( int x = 3; x <= 5; ++x )
+        shape_set.erase( Point( x, y, z ) );
+  Shapes<Domain>::removeNorm2Ball( shape_set, Point( -4, 0, 0 ), 2 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( 9, 9, 9 ), 1 );
+  ObjectType shape( dt18_6, shape_set );
+
+  Expander<ObjectType> expander( shape, Point( 0, 0, 10 ) );
+  DenseExpander<ObjectType> denseExpander( shape, Point( 0, 0, 10 ) );
+  INBLOCK_TEST( sameLayers( expander, denseExpander ) );
+  INBLOCK_TEST( denseExpander.coreSize() + 7 == shape.size() );
+  INBLOCK_TEST( ! denseExpander.inCore( Point( 9, 9, 9 ) ) );
+  INBLOCK_TEST( ! denseExpander.nextLayer() );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class DenseExpander" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testDenseExpander2D()
+    && testDenseExpander3D();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
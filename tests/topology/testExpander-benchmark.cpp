@@ -42,6 +42,7 @@
 #include "DGtal/topology/DigitalTopology.h"
 #include "DGtal/topology/Object.h"
 #include "DGtal/topology/Expander.h"
+#include "DGtal/topology/DenseExpander.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -90,6 +91,7 @@ bool testExpander()
   typedef DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
   typedef Object<DT6_18, DigitalSet> ObjectType;
   typedef Expander< ObjectType > ObjectExpander;
+  typedef DenseExpander< ObjectType > ObjectDenseExpander;
   // ----------------------- Domain, Topology ------------------------------
   Point p1( -50, -50, -50 );
   Point p2( 50, 50, 50 );
@@ -170,7 +172,45 @@ bool testExpander()
          << " <= " << sqrt(2.0)*M_PI*radius << std::endl;
   trace.endBlock();
 
-  
+  trace.beginBlock ( "Testing dense expansion by layers in the ball from center..." );
+  ObjectDenseExpander denseExpander( ball, c );
+  ObjectExpander expander3( ball, c );
+  bool sameLayers = true;
+  while ( ! denseExpander.finished() )
+    {
+      trace.info() << denseExpander << std::endl;
+      sameLayers = sameLayers
+        && ( denseExpander.distance() == expander3.distance() )
+        && ( denseExpander.layer().size() == expander3.layer().size() );
+      denseExpander.nextLayer();
+      expander3.nextLayer();
+    }
+  sameLayers = sameLayers && expander3.finished()
+    && ( denseExpander.distance() == expander3.distance() )
+    && ( denseExpander.coreSize() == ball.size() );
+  INBLOCK_TEST( sameLayers );
+  trace.endBlock();
+
+  trace.beginBlock ( "Timing expansion by layers in the ball from center..." );
+  ObjectExpander expander4( ball, c );
+  while ( expander4.nextLayer() )
+    ;
+  long timeSet = trace.endBlock();
+  trace.beginBlock ( "Timing dense expansion by layers in the ball from center..." );
+  ObjectDenseExpander denseExpander2( ball, c );
+  while ( denseExpander2.nextLayer() )
+    ;
+  long timeDense = trace.endBlock();
+  trace.info() << "Expander: " << timeSet << " ms, DenseExpander: "
+               << timeDense << " ms." << std::endl;
+
+  trace.beginBlock ( "Testing dense expansion by layers on the sphere from a point ..." );
+  ObjectDenseExpander denseExpander3( sphere, l );
+  while ( ! denseExpander3.finished() )
+    denseExpander3.nextLayer();
+  INBLOCK_TEST( denseExpander3.distance() == expander2.distance() );
+  trace.endBlock();
+
   return nbok == nb;
 }
 
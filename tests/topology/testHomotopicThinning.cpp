@@ -0,0 +1,251 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHomotopicThinning.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/05/30
+ *
+ * Functions for testing class HomotopicThinning.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/nd/volumetric/DistanceTransformation.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/topology/HomotopicThinning.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class HomotopicThinning.
+///////////////////////////////////////////////////////////////////////////////
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+         << #x << std::endl;
+
+/**
+ * @return the number of connected components of [object].
+ */
+template <typename TObject>
+unsigned int nbComponents( const TObject & object )
+{
+  std::vector<TObject> components;
+  std::back_insert_iterator< std::vector<TObject> > it( components );
+  return (unsigned int) object.writeComponents( it );
+}
+
+/**
+ * @return the number of connected components of the complement of
+ * [object] in [domain].
+ */
+template <typename TObject>
+unsigned int nbComplementComponents( const TObject & object,
+                                     const typename TObject::Domain & domain )
+{
+  typedef typename TObject::ComplementObject ComplementObject;
+  typename TObject::DigitalSet complement( domain );
+  complement.assignFromComplement( object.pointSet() );
+  ComplementObject compObject( object.topology().reverseTopology(),
+                               complement );
+  return nbComponents( compObject );
+}
+
+/**
+ * @return 'true' iff no point of [object] could be removed by
+ * [thinning].
+ */
+template <typename TObject>
+bool isThin( const TObject & object,
+             const HomotopicThinning<TObject> & thinning )
+{
+  typedef typename TObject::DigitalSet::ConstIterator ConstIterator;
+  const std::vector<typename TObject::Point> & anchors = thinning.anchors();
+  for ( ConstIterator it = object.pointSet().begin(),
+          itEnd = object.pointSet().end(); it != itEnd; ++it )
+    {
+      if ( std::find( anchors.begin(), anchors.end(), *it ) != anchors.end() )
+        continue;
+      if ( thinning.preserveEndPoints()
+           && ( object.properNeighborhoodSize( *it ) == 1 ) )
+        continue;
+      if ( object.isSimple( *it ) )
+        return false;
+    }
+  return true;
+}
+
+/**
+ * Thins [shape] and checks that its topology is preserved and that
+ * the result is thin.
+ */
+template <typename TObject>
+bool checkThinning( const TObject & shape,
+                    HomotopicThinning<TObject> & thinning,
+                    const typename TObject::Domain & domain,
+                    TObject & result )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  result = TObject( shape.topology(), shape.pointSet() );
+  const typename TObject::Size nbRemoved = thinning.thin( result );
+  trace.info() << thinning << " " << shape.size() << " -> "
+               << result.size() << " points." << endl;
+  INBLOCK_TEST( shape.size() == result.size() + nbRemoved );
+  INBLOCK_TEST( nbComponents( shape ) == nbComponents( result ) );
+  INBLOCK_TEST( nbComplementComponents( shape, domain )
+                == nbComplementComponents( result, domain ) );
+  INBLOCK_TEST( isThin( result, thinning ) );
+  return nbok == nb;
+}
+
+/**
+ * Thinning of a 2D shape with holes, by layers and by subfields.
+ */
+template <typename TObject>
+bool testThinning2D( const typename TObject::DigitalTopology & dt )
+{
+  typedef Z2i::Point Point;
+  typedef Z2i::Domain Domain;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing 2D homotopic thinning ..." );
+  Domain domain( Point( -22, -22 ), Point( 22, 22 ) );
+  Z2i::DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( -10, 0 ), 6 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( -8, 8 ), 6 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( 0, 9 ), 6 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( 15, -2 ), 6 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( 12, -10 ), 4 );
+  shape_set.erase( Point( 5, 0 ) );
+  shape_set.erase( Point( -1, -2 ) );
+  shape_set.erase( Point( -9, 2 ) );
+  TObject shape( dt, shape_set );
+  TObject result;
+
+  HomotopicThinning<TObject> thinning;
+  INBLOCK_TEST( checkThinning( shape, thinning, domain, result ) );
+
+  thinning.setNumberOfThreads( 2 );
+  INBLOCK_TEST( checkThinning( shape, thinning, domain, result ) );
+
+  thinning.setNumberOfThreads( 1 );
+  thinning.setPreserveEndPoints( true );
+  thinning.addAnchor( Point( -14, 0 ) );
+  thinning.addAnchor( Point( 12, -12 ) );
+  INBLOCK_TEST( checkThinning( shape, thinning, domain, result ) );
+  INBLOCK_TEST( result.pointSet().find( Point( -14, 0 ) ) != result.pointSet().end() );
+  INBLOCK_TEST( result.pointSet().find( Point( 12, -12 ) ) != result.pointSet().end() );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Thinning of a 3D ball with a tunnel and a cavity, by layers, by
+ * subfields and by distance.
+ */
+template <typename TObject>
+bool testThinning3D( const typename TObject::DigitalTopology & dt )
+{
+  typedef Z3i::Point Point;
+  typedef Z3i::Domain Domain;
+  typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+  typedef DistanceTransformation<Image, 2> DT;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing 3D homotopic thinning ..." );
+  Domain domain( Point( -12, -12, -12 ), Point( 12, 12, 12 ) );
+  Z3i::DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point( 0, 0, 0 ), 10 );
+  for ( int z = -12; z <= 12; ++z )
+    for ( int y = -1; y <= 1; ++y )
+      for ( int x = 3; x <= 5; ++x )
+        shape_set.erase( Point( x, y, z ) );
+  Shapes<Domain>::removeNorm2Ball( shape_set, Point( -4, 0, 0 ), 2 );
+  TObject shape( dt, shape_set );
+  TObject result;
+
+  HomotopicThinning<TObject> thinning;
+  INBLOCK_TEST( checkThinning( shape, thinning, domain, result ) );
+
+  thinning.setNumberOfThreads( 0 );
+  INBLOCK_TEST( checkThinning( shape, thinning, domain, result ) );
+  thinning.setNumberOfThreads( 1 );
+
+  // Thinning ordered by the distance to the complement.
+  Image image( domain.lowerBound(), domain.upperBound() );
+  for ( Z3i::DigitalSet::ConstIterator it = shape_set.begin(),
+          itEnd = shape_set.end(); it != itEnd; ++it )
+    image.setValue( *it, 1 );
+  DT distance;
+  DT::OutputImage distanceMap = distance.compute( image );
+  result = TObject( shape.topology(), shape.pointSet() );
+  thinning.setPreserveEndPoints( true );
+  const typename TObject::Size nbRemoved = thinning.thin( result, distanceMap );
+  trace.info() << thinning << " " << shape.size() << " -> "
+               << result.size() << " points (by distance)." << endl;
+  INBLOCK_TEST( shape.size() == result.size() + nbRemoved );
+  INBLOCK_TEST( nbComponents( shape ) == nbComponents( result ) );
+  INBLOCK_TEST( nbComplementComponents( shape, domain )
+                == nbComplementComponents( result, domain ) );
+  INBLOCK_TEST( isThin( result, thinning ) );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class HomotopicThinning" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testThinning2D<Z2i::Object4_8>( Z2i::dt4_8 )
+    && testThinning2D<Z2i::Object8_4>( Z2i::dt8_4 )
+    && testThinning3D<Z3i::Object6_26>( Z3i::dt6_26 )
+    && testThinning3D<Z3i::Object26_6>( Z3i::dt26_6 )
+    && testThinning3D<Z3i::Object18_6>( Z3i::dt18_6 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,8 @@
 #include <iostream>
 #include <sstream>
 #include <queue>
+#include <algorithm>
+#include <boost/function_output_iterator.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/DomainPredicate.h"
@@ -657,6 +659,190 @@ bool testSimplePoints2D()
 
 
 
+/**
+ * Compares Object::border and Object::writeComponents, computed on a
+ * dense array, with the same computations on the point set.
+ */
+template <typename TObject>
+bool checkDenseBorderAndComponents( const TObject & shape )
+{
+  typedef typename TObject::Point Point;
+  typedef typename TObject::DigitalSet DigitalSet;
+  typedef typename DigitalSet::ConstIterator ConstIterator;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  // Border with the neighborhoods in the domain.
+  DigitalSet border_set( shape.domain() );
+  for ( ConstIterator it = shape.pointSet().begin(),
+          itEnd = shape.pointSet().end(); it != itEnd; ++it )
+    {
+      std::vector<Point> neigh;
+      std::back_insert_iterator< std::vector<Point> > inserter( neigh );
+      shape.topology().lambda().writeProperNeighborhood
+        ( *it, inserter, shape.domain().predicate() );
+      for ( unsigned int i = 0; i < neigh.size(); ++i )
+        if ( shape.pointSet().find( neigh[ i ] ) == itEnd )
+          {
+            border_set.insertNew( *it );
+            break;
+          }
+    }
+  TObject border = shape.border();
+  trace.info() << "border.size() = " << border.size() << endl;
+  INBLOCK_TEST( border.size() == border_set.size() );
+  INBLOCK_TEST( std::equal( border_set.begin(), border_set.end(),
+                            border.pointSet().begin() ) );
+
+  // Components with an Expander started at the first unvisited point.
+  std::vector<DigitalSet> components;
+  DigitalSet visited( shape.domain() );
+  for ( ConstIterator it = shape.pointSet().begin(),
+          itEnd = shape.pointSet().end(); it != itEnd; ++it )
+    if ( visited.find( *it ) == visited.end() )
+      {
+        Expander<TObject> expander( shape, *it );
+        while ( expander.nextLayer() )
+          ;
+        components.push_back( expander.core() );
+        visited += expander.core();
+      }
+  std::vector<TObject> objects;
+  std::back_insert_iterator< std::vector<TObject> > ito( objects );
+  TObject( shape.topology(), shape.pointSet() ).writeComponents( ito );
+  trace.info() << "nb components = " << objects.size() << endl;
+  INBLOCK_TEST( objects.size() == components.size() );
+  bool same = objects.size() == components.size();
+  for ( unsigned int i = 0; same && ( i < objects.size() ); ++i )
+    {
+      const TObject & component = objects[ i ];
+      same = ( component.size() == components[ i ].size() )
+        && std::equal( components[ i ].begin(), components[ i ].end(),
+                       component.pointSet().begin() )
+        && ( component.connectedness() == TObject::CONNECTED );
+    }
+  INBLOCK_TEST( same );
+  return nbok == nb;
+}
+
+/**
+ * Border and components of shapes touching the domain boundary.
+ */
+bool testDenseBorderAndComponents()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing dense border and components in 2D ..." );
+  Z2i::Domain domain2( Z2i::Point( -12, -12 ), Z2i::Point( 12, 12 ) );
+  Z2i::DigitalSet set2( domain2 );
+  Shapes<Z2i::Domain>::addNorm1Ball( set2, Z2i::Point( -8, -8 ), 6 );
+  Shapes<Z2i::Domain>::addNorm1Ball( set2, Z2i::Point( 5, 4 ), 4 );
+  Shapes<Z2i::Domain>::addNorm1Ball( set2, Z2i::Point( 10, -10 ), 3 );
+  Shapes<Z2i::Domain>::addNorm2Ball( set2, Z2i::Point( -8, 8 ), 3 );
+  set2.insertNew( Z2i::Point( 0, 0 ) );
+  set2.insertNew( Z2i::Point( 1, -1 ) );
+  INBLOCK_TEST( checkDenseBorderAndComponents( Z2i::Object4_8( Z2i::dt4_8, set2 ) ) );
+  INBLOCK_TEST( checkDenseBorderAndComponents( Z2i::Object8_4( Z2i::dt8_4, set2 ) ) );
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing dense border and components in 3D ..." );
+  Z3i::Domain domain3( Z3i::Point( -8, -8, -8 ), Z3i::Point( 8, 8, 8 ) );
+  Z3i::DigitalSet set3( domain3 );
+  Shapes<Z3i::Domain>::addNorm2Ball( set3, Z3i::Point( -6, -6, -6 ), 4 );
+  Shapes<Z3i::Domain>::addNorm2Ball( set3, Z3i::Point( 4, 4, 0 ), 3 );
+  Shapes<Z3i::Domain>::addNorm1Ball( set3, Z3i::Point( 7, -6, 7 ), 2 );
+  set3.insertNew( Z3i::Point( 0, 0, 0 ) );
+  set3.insertNew( Z3i::Point( 1, 1, 0 ) );
+  set3.insertNew( Z3i::Point( 2, 2, 2 ) );
+  INBLOCK_TEST( checkDenseBorderAndComponents( Z3i::Object6_26( Z3i::dt6_26, set3 ) ) );
+  INBLOCK_TEST( checkDenseBorderAndComponents( Z3i::Object18_6( Z3i::dt18_6, set3 ) ) );
+  INBLOCK_TEST( checkDenseBorderAndComponents( Z3i::Object26_6( Z3i::dt26_6, set3 ) ) );
+
+  // A ball with a cavity and two isolated corners, dense enough in its
+  // bounding box for the dense algorithms.
+  Z3i::DigitalSet set3b( domain3 );
+  Shapes<Z3i::Domain>::addNorm2Ball( set3b, Z3i::Point( 0, 0, 0 ), 7 );
+  Shapes<Z3i::Domain>::removeNorm2Ball( set3b, Z3i::Point( 3, 0, 0 ), 2 );
+  set3b.insertNew( Z3i::Point( 8, 8, 8 ) );
+  set3b.insertNew( Z3i::Point( -8, 8, -8 ) );
+  INBLOCK_TEST( checkDenseBorderAndComponents( Z3i::Object6_26( Z3i::dt6_26, set3b ) ) );
+  INBLOCK_TEST( checkDenseBorderAndComponents( Z3i::Object26_6( Z3i::dt26_6, set3b ) ) );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Records the sizes of the components written by
+ * Object::writeComponents, without keeping the components.
+ */
+template <typename TObject>
+struct ComponentSizes
+{
+  std::vector<typename TObject::Size>* sizes;
+  bool* connected;
+  void operator()( const TObject & component ) const
+  {
+    sizes->push_back( component.size() );
+    *connected = *connected
+      && ( component.connectedness() == TObject::CONNECTED );
+  }
+};
+
+/**
+ * Border and components of objects that are sparse in their bounding
+ * box (which use the point set), and of many small components in a
+ * large domain.
+ */
+bool testSparseAndManyComponents()
+{
+  typedef Z3i::Point Point;
+  typedef Z3i::Domain Domain;
+  typedef DigitalSetBySTLSet<Domain> SparseSet;
+  typedef Object<Z3i::DT26_6, SparseSet> SparseObject;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing border and components of sparse objects ..." );
+  Domain huge( Point( -100000, -100000, -100000 ),
+               Point( 100000, 100000, 100000 ) );
+  SparseSet sparse( huge );
+  sparse.insertNew( Point( -100000, -100000, -100000 ) );
+  sparse.insertNew( Point( 100000, 100000, 100000 ) );
+  for ( int i = -25; i < 25; ++i )
+    sparse.insertNew( Point( 1000 + i, i, -i ) );
+  INBLOCK_TEST( checkDenseBorderAndComponents
+                ( SparseObject( Z3i::dt26_6, sparse ) ) );
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing many components in a large domain ..." );
+  Domain domain( Point( -1, -1, -1 ), Point( 127, 127, 127 ) );
+  Domain cubesDomain( Point( 0, 0, 0 ), Point( 127, 127, 127 ) );
+  Z3i::DigitalSet cubes( domain );
+  for ( Domain::ConstIterator it = cubesDomain.begin(),
+          itEnd = cubesDomain.end(); it != itEnd; ++it )
+    if ( ( (*it)[ 0 ] % 8 < 5 ) && ( (*it)[ 1 ] % 8 < 5 )
+         && ( (*it)[ 2 ] % 8 < 5 ) )
+      cubes.insertNew( *it );
+  Z3i::Object26_6 object( Z3i::dt26_6, cubes );
+  std::vector<Z3i::Object26_6::Size> sizes;
+  bool connected = true;
+  ComponentSizes<Z3i::Object26_6> recorder = { &sizes, &connected };
+  boost::function_output_iterator< ComponentSizes<Z3i::Object26_6> >
+    ito( recorder );
+  const Z3i::Object26_6::Size nbComponents = object.writeComponents( ito );
+  trace.info() << "nb components = " << nbComponents << endl;
+  INBLOCK_TEST( nbComponents == 16 * 16 * 16 );
+  INBLOCK_TEST( sizes.size() == nbComponents );
+  INBLOCK_TEST( connected );
+  INBLOCK_TEST( std::count( sizes.begin(), sizes.end(), 125u ) == 4096 );
+  INBLOCK_TEST( object.border().size() == 4096u * ( 125 - 27 ) );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -671,7 +857,9 @@ int main( int argc, char** argv )
   bool res = testObject() && 
     testObject3D() && testDraw()
     && testSimplePoints3D()
-    && testSimplePoints2D();
+    && testSimplePoints2D()
+    && testDenseBorderAndComponents()
+    && testSparseAndManyComponents();
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
@@ -0,0 +1,315 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedKhalimskySpaceND.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/05/18
+ *
+ * Functions for testing class PackedKhalimskySpaceND.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/kernel/sets/SetPredicate.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/PackedKhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/CellHashSet.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedKhalimskySpaceND.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A signed cell as Khalimsky coordinates and sign, comparable
+ * between the two spaces.
+ */
+template <typename KSpace>
+std::pair<typename KSpace::Point, bool>
+raw( const KSpace & K, const typename KSpace::SCell & c )
+{
+  return std::make_pair( K.sKCoords( c ), K.sSign( c ) == K.POS );
+}
+
+template <typename KSpace>
+std::vector< std::pair<typename KSpace::Point, bool> >
+raw( const KSpace & K, const typename KSpace::SCells & cells )
+{
+  std::vector< std::pair<typename KSpace::Point, bool> > v;
+  for ( typename KSpace::SCells::const_iterator it = cells.begin();
+        it != cells.end(); ++it )
+    v.push_back( raw( K, *it ) );
+  return v;
+}
+
+template <typename KSpace>
+std::vector<typename KSpace::Point>
+raw( const KSpace & K, const typename KSpace::Cells & cells )
+{
+  std::vector<typename KSpace::Point> v;
+  for ( typename KSpace::Cells::const_iterator it = cells.begin();
+        it != cells.end(); ++it )
+    v.push_back( K.uKCoords( *it ) );
+  return v;
+}
+
+template <typename KSpace, typename DirIterator>
+std::vector<Dimension> dirs( DirIterator it )
+{
+  std::vector<Dimension> v;
+  for ( ; it != 0; ++it ) v.push_back( *it );
+  return v;
+}
+
+/**
+ * Checks that the services of PackedKhalimskySpaceND give the same
+ * cells as the ones of KhalimskySpaceND, on random cells.
+ */
+template <Dimension dim>
+bool testServices( const typename KhalimskySpaceND<dim>::Point & low,
+                   const typename KhalimskySpaceND<dim>::Point & high,
+                   bool closed )
+{
+  typedef KhalimskySpaceND<dim> KSpace;
+  typedef PackedKhalimskySpaceND<dim> PKSpace;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::SCell SCell;
+  typedef typename PKSpace::SCell PSCell;
+  typedef typename PKSpace::Cell PCell;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing services of PackedKhalimskySpaceND ..." );
+  KSpace K;
+  PKSpace P;
+  nbok += K.init( low, high, closed ) && P.init( low, high, closed ) ? 1 : 0;
+  nb++;
+  trace.info() << P << " dim=" << dim << " closed=" << closed
+               << " sizeof(SCell)=" << sizeof( PSCell )
+               << " (vs " << sizeof( SCell ) << ")" << endl;
+  srand( 3 );
+  unsigned int nbErrors = 0;
+  for ( unsigned int n = 0; n < 2000; ++n )
+    {
+      Point kp;
+      for ( Dimension k = 0; k < dim; ++k )
+        kp[ k ] = 2 * low[ k ] + ( closed ? 0 : 1 )
+          + rand() % ( 2 * ( high[ k ] - low[ k ] ) + ( closed ? 3 : 1 ) );
+      bool sign = ( rand() % 2 ) == 0;
+      SCell c = K.sCell( kp, sign );
+      PSCell pc = P.sCell( kp, sign );
+      PCell puc = P.unsigns( pc );
+      Point p = K.sCoords( c );
+      bool ok = raw( K, c ) == raw( P, pc )
+        && P.uKCoords( puc ) == kp
+        && K.sCoords( c ) == P.sCoords( pc )
+        && K.sDim( c ) == P.sDim( pc )
+        && K.sTopology( c ) == P.sTopology( pc )
+        && K.sIsSurfel( c ) == P.sIsSurfel( pc )
+        && dirs<KSpace>( K.sDirs( c ) ) == dirs<PKSpace>( P.sDirs( pc ) )
+        && dirs<KSpace>( K.sOrthDirs( c ) ) == dirs<PKSpace>( P.sOrthDirs( pc ) )
+        && raw( K, K.sOpp( c ) ) == raw( P, P.sOpp( pc ) )
+        && raw( K, K.sFirst( c ) ) == raw( P, P.sFirst( pc ) )
+        && raw( K, K.sLast( c ) ) == raw( P, P.sLast( pc ) )
+        && raw( K, K.sSpel( p, sign ) ) == raw( P, P.sSpel( p, sign ) )
+        && raw( K, K.sPointel( p, sign ) ) == raw( P, P.sPointel( p, sign ) )
+        && raw( K, K.sCell( p, c ) ) == raw( P, P.sCell( p, pc ) )
+        && raw( K, K.sLowerIncident( c ) ) == raw( P, P.sLowerIncident( pc ) )
+        && raw( K, K.sUpperIncident( c ) ) == raw( P, P.sUpperIncident( pc ) )
+        && raw( K, K.sNeighborhood( c ) ) == raw( P, P.sNeighborhood( pc ) );
+      bool interior = true;
+      for ( Dimension k = 0; k < dim; ++k )
+        {
+          ok = ok && K.sIsOpen( c, k ) == P.sIsOpen( pc, k )
+            && K.sIsMax( c, k ) == P.sIsMax( pc, k )
+            && K.sIsMin( c, k ) == P.sIsMin( pc, k )
+            && K.uIsInside( K.unsigns( c ), k ) == P.uIsInside( puc, k )
+            && K.sDistanceToMax( c, k ) == P.sDistanceToMax( pc, k )
+            && K.sDistanceToMin( c, k ) == P.sDistanceToMin( pc, k )
+            && raw( K, K.sGetMax( c, k ) ) == raw( P, P.sGetMax( pc, k ) )
+            && raw( K, K.sGetMin( c, k ) ) == raw( P, P.sGetMin( pc, k ) )
+            && raw( K, K.sAdjacent( c, k, true ) ) == raw( P, P.sAdjacent( pc, k, true ) )
+            && raw( K, K.sAdjacent( c, k, false ) ) == raw( P, P.sAdjacent( pc, k, false ) );
+          if ( K.sDistanceToMax( c, k ) > 1 && K.sDistanceToMin( c, k ) > 1 )
+            ok = ok && raw( K, K.sGetAdd( c, k, -1 ) ) == raw( P, P.sGetAdd( pc, k, -1 ) )
+              && raw( K, K.sGetSub( c, k, 1 ) ) == raw( P, P.sGetSub( pc, k, 1 ) );
+          interior = interior && ! K.sIsMax( c, k ) && ! K.sIsMin( c, k );
+          if ( ! K.sIsMax( c, k ) && ! K.sIsMin( c, k ) )
+            ok = ok && K.sDirect( c, k ) == P.sDirect( pc, k )
+              && raw( K, K.sIncident( c, k, true ) ) == raw( P, P.sIncident( pc, k, true ) )
+              && raw( K, K.sIncident( c, k, false ) ) == raw( P, P.sIncident( pc, k, false ) )
+              && raw( K, K.sDirectIncident( c, k ) ) == raw( P, P.sDirectIncident( pc, k ) )
+              && raw( K, K.sIndirectIncident( c, k ) ) == raw( P, P.sIndirectIncident( pc, k ) );
+          SCell d = c;
+          PSCell pd = pc;
+          K.sSetKCoord( d, k, 2 * low[ k ] + ( closed ? 0 : 1 ) );
+          P.sSetKCoord( pd, k, 2 * low[ k ] + ( closed ? 0 : 1 ) );
+          ok = ok && raw( K, d ) == raw( P, pd );
+        }
+      if ( interior )
+        ok = ok && raw( K, K.uFaces( K.unsigns( c ) ) ) == raw( P, P.uFaces( puc ) )
+          && raw( K, K.uCoFaces( K.unsigns( c ) ) ) == raw( P, P.uCoFaces( puc ) );
+      if ( ! ok )
+        {
+          if ( nbErrors++ < 5 )
+            trace.error() << "Differs at " << c << " " << pc << endl;
+        }
+    }
+  nbok += ( nbErrors == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same cells as KhalimskySpaceND" << std::endl;
+
+  // Scanning of all the spels.
+  typename PKSpace::Cell first = P.uFirst( P.uSpel( low ) );
+  typename PKSpace::Cell last = P.uLast( P.uSpel( low ) );
+  typename PKSpace::Cell q = first;
+  typename KSpace::Cell kq = K.uFirst( K.uSpel( low ) );
+  typename KSpace::Cell klast = K.uLast( K.uSpel( low ) );
+  unsigned int nbSame = 0, nbSpels = 0;
+  do {
+    nbSame += ( P.uKCoords( q ) == K.uKCoords( kq ) ) ? 1 : 0;
+    ++nbSpels;
+    K.uNext( kq, K.uFirst( kq ), klast );
+  } while ( P.uNext( q, first, last ) );
+  unsigned int expected = 1;
+  for ( Dimension k = 0; k < dim; ++k ) expected *= P.size( k );
+  nbok += ( nbSame == nbSpels && nbSpels == expected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "uNext visits the " << expected << " spels" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Tracks the boundary of a ball with both spaces.
+ */
+bool testTracking()
+{
+  typedef KhalimskySpaceND<3> KSpace;
+  typedef PackedKhalimskySpaceND<3> PKSpace;
+  typedef KSpace::Space Space;
+  typedef KSpace::Point Point;
+  typedef HyperRectDomain<Space> Domain;
+  typedef DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing boundary tracking in PackedKhalimskySpaceND ..." );
+  Point low( -12, -12, -12 );
+  Point high( 12, 12, 12 );
+  Domain domain( low, high );
+  DigitalSet ball( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( (*it).norm() <= 10.5 ) ball.insert( *it );
+  SetPredicate<DigitalSet> pp( ball );
+  KSpace K;
+  PKSpace P;
+  K.init( low, high, true );
+  P.init( low, high, true );
+  SurfelAdjacency<3> SAdj( true );
+
+  std::set<KSpace::SCell> surface;
+  KSpace::SCell bel = Surfaces<KSpace>::findABel( K, pp, Point( 0, 0, 0 ), Point( 12, 0, 0 ) );
+  Surfaces<KSpace>::trackBoundary( surface, K, SAdj, pp, bel );
+  std::set<PKSpace::SCell> psurface;
+  PKSpace::SCell pbel = Surfaces<PKSpace>::findABel( P, pp, Point( 0, 0, 0 ), Point( 12, 0, 0 ) );
+  Surfaces<PKSpace>::trackBoundary( psurface, P, SAdj, pp, pbel );
+  nbok += raw( K, bel ) == raw( P, pbel ) ? 1 : 0;
+  nb++;
+  std::set< std::pair<Point,bool> > a, b;
+  for ( std::set<KSpace::SCell>::const_iterator it = surface.begin();
+        it != surface.end(); ++it )
+    a.insert( raw( K, *it ) );
+  for ( std::set<PKSpace::SCell>::const_iterator it = psurface.begin();
+        it != psurface.end(); ++it )
+    b.insert( raw( P, *it ) );
+  nbok += ( a == b ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << surface.size() << " surfels, packed " << psurface.size()
+               << std::endl;
+
+  CellHashSet<PKSpace> hsurface( P );
+  Surfaces<PKSpace>::trackBoundary( hsurface, P, SAdj, pp, pbel );
+  unsigned int nbFound = 0;
+  for ( std::set<PKSpace::SCell>::const_iterator it = psurface.begin();
+        it != psurface.end(); ++it )
+    nbFound += hsurface.count( *it );
+  nbok += ( hsurface.size() == psurface.size()
+            && nbFound == psurface.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "CellHashSet with packed cells " << hsurface << std::endl;
+
+  // Bounds that cannot be packed.
+  PKSpace Q;
+  nbok += Q.init( Point( -1000000, -1000000, -1000000 ),
+                  Point( 1000000, 1000000, 1000000 ), true ) ? 0 : 1;
+  nb++;
+  nbok += ( Q.lowerBound() != Point( -1000000, -1000000, -1000000 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "too large bounds are rejected" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class PackedKhalimskySpaceND" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  typedef KhalimskySpaceND<2>::Point P2;
+  typedef KhalimskySpaceND<3>::Point P3;
+  typedef KhalimskySpaceND<4>::Point P4;
+  bool res = testServices<2>( P2( -5, -3 ), P2( 7, 4 ), true )
+    && testServices<2>( P2( -5, -3 ), P2( 7, 4 ), false )
+    && testServices<3>( P3( -4, 0, -2 ), P3( 3, 5, 6 ), true )
+    && testServices<3>( P3( -4, 0, -2 ), P3( 3, 5, 6 ), false )
+    && testServices<4>( P4( -2, -1, 0, -3 ), P4( 2, 3, 2, 1 ), true )
+    && testTracking();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
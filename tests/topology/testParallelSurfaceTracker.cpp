@@ -0,0 +1,185 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testParallelSurfaceTracker.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/05/17
+ *
+ * Functions for testing class ParallelSurfaceTracker.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/kernel/sets/SetPredicate.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/CellHashSet.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/helpers/ParallelSurfaceTracker.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+         << #x << std::endl;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ParallelSurfaceTracker.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef KhalimskySpaceND<3> KSpace;
+typedef KSpace::Space Space;
+typedef KSpace::Point Point;
+typedef KSpace::Cell Cell;
+typedef KSpace::SCell SCell;
+typedef HyperRectDomain<Space> Domain;
+typedef DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+
+/**
+ * Serial reference: tracks each seed not on an already tracked surface.
+ */
+template <typename PointPredicate>
+void referenceSurfaces( std::vector< std::vector<SCell> > & surfaces,
+                        const KSpace & K, const SurfelAdjacency<3> & SAdj,
+                        const PointPredicate & pp,
+                        const std::vector<SCell> & seeds )
+{
+  std::set<SCell> tracked;
+  surfaces.clear();
+  for ( unsigned int i = 0; i < seeds.size(); ++i )
+    {
+      if ( tracked.find( seeds[ i ] ) != tracked.end() ) continue;
+      std::set<SCell> surface;
+      Surfaces<KSpace>::trackBoundary( surface, K, SAdj, pp, seeds[ i ] );
+      tracked.insert( surface.begin(), surface.end() );
+      surfaces.push_back( std::vector<SCell>( surface.begin(), surface.end() ) );
+    }
+}
+
+bool testParallelSurfaceTracker()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ParallelSurfaceTracker on random blobs ..." );
+  Point low( -15, -12, -10 );
+  Point high( 16, 12, 11 );
+  KSpace K;
+  K.init( low, high, true );
+  Domain domain( low, high );
+  DigitalSet shape( domain );
+  srand( 5 );
+  std::vector<Point> centers;
+  for ( unsigned int i = 0; i < 12; ++i )
+    centers.push_back( Point( rand() % 30 - 14, rand() % 24 - 11, rand() % 20 - 9 ) );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      bool in = ( rand() % 31 ) == 0;
+      for ( unsigned int i = 0; ( i < centers.size() ) && ! in; ++i )
+        in = ( *it - centers[ i ] ).norm() <= 4.0;
+      if ( in ) shape.insert( *it );
+    }
+  SetPredicate<DigitalSet> pp( shape );
+
+  // All the bels are seeds, in a shuffled order.
+  std::set<SCell> bdry;
+  Surfaces<KSpace>::sMakeBoundary( bdry, K, pp,
+                                   K.uFirst( K.uSpel( low ) ),
+                                   K.uLast( K.uSpel( high ) ) );
+  std::vector<SCell> seeds( bdry.begin(), bdry.end() );
+  std::random_shuffle( seeds.begin(), seeds.end() );
+  seeds.resize( seeds.size() / 2 );
+
+  for ( unsigned int i = 0; i < 2; ++i )
+    {
+      SurfelAdjacency<3> SAdj( i == 0 );
+      std::vector< std::vector<SCell> > ref;
+      referenceSurfaces( ref, K, SAdj, pp, seeds );
+      ParallelSurfaceTracker<KSpace> tracker( K, SAdj );
+      for ( unsigned int nbThreads = 1; nbThreads <= 4; nbThreads += 3 )
+        {
+          tracker.setNumberOfThreads( nbThreads );
+          std::vector< std::vector<SCell> > surfaces;
+          tracker.trackBoundaries( surfaces, pp, seeds );
+          trace.info() << tracker << " " << surfaces.size()
+                       << " surfaces (reference " << ref.size()
+                       << "), interior=" << ( i == 0 ) << endl;
+          INBLOCK_TEST( surfaces == ref );
+        }
+    }
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing level parallel tracking of one surface ..." );
+  Domain bigDomain( Point( -30, -30, -30 ), Point( 30, 30, 30 ) );
+  KSpace K2;
+  K2.init( bigDomain.lowerBound(), bigDomain.upperBound(), true );
+  DigitalSet ball( bigDomain );
+  for ( Domain::ConstIterator it = bigDomain.begin(); it != bigDomain.end(); ++it )
+    if ( (*it).norm() <= 25.5 || ( (*it) - Point( 20, 0, 0 ) ).norm() <= 9 ) ball.insert( *it );
+  SetPredicate<DigitalSet> ballPredicate( ball );
+  SurfelAdjacency<3> SAdj( true );
+  SCell bel = Surfaces<KSpace>::findABel( K2, ballPredicate,
+                                          Point( 0, 0, 0 ), Point( 30, 0, 0 ) );
+  std::set<SCell> ref;
+  Surfaces<KSpace>::trackBoundary( ref, K2, SAdj, ballPredicate, bel );
+  ParallelSurfaceTracker<KSpace> tracker( K2, SAdj );
+  tracker.setNumberOfThreads( 4 );
+  std::set<SCell> surface;
+  tracker.trackBoundary( surface, ballPredicate, bel );
+  INBLOCK_TEST( surface == ref );
+  CellHashSet<KSpace> hSurface( K2 );
+  tracker.trackBoundary( hSurface, ballPredicate, bel );
+  trace.info() << ref.size() << " surfels, " << hSurface << endl;
+  INBLOCK_TEST( std::set<SCell>( hSurface.begin(), hSurface.end() ) == ref );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ParallelSurfaceTracker" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testParallelSurfaceTracker();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,193 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSimplePointTable.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/05/27
+ *
+ * Functions for testing class SimplePointTable.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/topology/SimplePointTable.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SimplePointTable.
+///////////////////////////////////////////////////////////////////////////////
+
+#define INBLOCK_TEST(x) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+         << #x << std::endl;
+
+/**
+ * Simplicity computed with the geodesic neighborhoods, as
+ * Object::isSimple does for any topology.
+ */
+template <typename TObject>
+bool referenceIsSimple( const TObject & object,
+                        const typename TObject::Point & v )
+{
+  typedef typename TObject::SmallObject SmallObject;
+  typedef typename TObject::SmallComplementObject SmallComplementObject;
+  const Dimension dim = TObject::Space::dimension;
+  SmallObject Gkappa_X
+    = object.geodesicNeighborhood( object.topology().kappa(), v, dim );
+  if ( ( Gkappa_X.computeConnectedness() != SmallObject::CONNECTED )
+       || Gkappa_X.pointSet().empty() )
+    return false;
+  SmallComplementObject Glambda_compX
+    = object.geodesicNeighborhoodInComplement( object.topology().lambda(),
+                                               v, dim );
+  return ( Glambda_compX.computeConnectedness()
+           == SmallComplementObject::CONNECTED )
+    && ( ! Glambda_compX.pointSet().empty() );
+}
+
+/**
+ * Compares Object::isSimple with the geodesic neighborhoods on
+ * [nbTests] configurations of the neighbors of the origin (all the
+ * configurations if nbTests is 0).
+ */
+template <typename TObject>
+bool testConfigurations( const typename TObject::DigitalTopology & dt,
+                         unsigned int nbTests )
+{
+  typedef typename TObject::Space Space;
+  typedef typename TObject::Point Point;
+  typedef typename TObject::Domain Domain;
+  typedef typename TObject::DigitalSet DigitalSet;
+  typedef NeighborhoodOffsets<Space, Space::dimension> Offsets;
+  typedef typename SimplePointTableSelector
+    < typename TObject::DigitalTopology >::Type Table;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing simple points with the table ..." );
+  Table::selfDisplay( trace.info() );
+  trace.info() << endl;
+  Point origin;
+  Point low, high;
+  for ( Dimension k = 0; k < Space::dimension; ++k )
+    {
+      low[ k ] = -2;
+      high[ k ] = 2;
+    }
+  Domain domain( low, high );
+  const unsigned int nbConfs = ( nbTests == 0 )
+    ? (unsigned int) Table::nbConfigurations : nbTests;
+  unsigned int nbSame = 0;
+  unsigned int nbSimple = 0;
+  for ( unsigned int n = 0; n < nbConfs; ++n )
+    {
+      typename Table::Configuration c = n;
+      if ( nbTests != 0 )
+        { // random configurations, sparse or dense.
+          const unsigned int r1 = ( (unsigned int) rand() << 16 ) ^ rand();
+          const unsigned int r2 = ( (unsigned int) rand() << 16 ) ^ rand();
+          c = (typename Table::Configuration)
+            ( ( ( n & 1 ) ? ( r1 & r2 ) : ( r1 | r2 ) )
+              & ( Table::nbConfigurations - 1 ) );
+        }
+      DigitalSet set( domain );
+      set.insertNew( origin );
+      for ( unsigned int i = 0; i < Offsets::size; ++i )
+        if ( ( c >> i ) & 1 )
+          set.insertNew( origin + Offsets::offset( i ) );
+      TObject object( dt, set );
+      const bool simple = object.isSimple( origin );
+      nbSimple += simple ? 1 : 0;
+      nbSame += ( ( simple == referenceIsSimple( object, origin ) )
+                  && ( simple == Table::computeIsSimple( c ) ) ) ? 1 : 0;
+    }
+  trace.info() << nbSimple << " simple points in " << nbConfs
+               << " configurations." << endl;
+  INBLOCK_TEST( nbSame == nbConfs );
+
+  // A point outside the object.
+  DigitalSet set( domain );
+  set.insertNew( origin + Offsets::offset( 0 ) );
+  TObject object( dt, set );
+  INBLOCK_TEST( object.isSimple( origin ) == referenceIsSimple( object, origin ) );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Writes and reads a table.
+ */
+bool testSaveLoad()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing save and load of a table ..." );
+  typedef SimplePointTable<2, 2, 1> Table8_4;
+  INBLOCK_TEST( Table8_4::hasTable() );
+  INBLOCK_TEST( Table8_4::saveTable( "simple-points-8-4.table" ) );
+  INBLOCK_TEST( Table8_4::loadTable( "simple-points-8-4.table" ) );
+  bool same = true;
+  for ( unsigned int c = 0; c < Table8_4::nbConfigurations; ++c )
+    same = same && ( Table8_4::isSimple( c ) == Table8_4::computeIsSimple( c ) );
+  INBLOCK_TEST( same );
+  INBLOCK_TEST( ! Table8_4::loadTable( "missing-file.table" ) );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SimplePointTable" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testConfigurations<Z2i::Object4_8>( Z2i::dt4_8, 0 )
+    && testConfigurations<Z2i::Object8_4>( Z2i::dt8_4, 0 )
+    && testConfigurations<Z3i::Object6_18>( Z3i::dt6_18, 2000 )
+    && testConfigurations<Z3i::Object18_6>( Z3i::dt18_6, 2000 )
+    && testConfigurations<Z3i::Object6_26>( Z3i::dt6_26, 2000 )
+    && testConfigurations<Z3i::Object26_6>( Z3i::dt26_6, 2000 )
+    && testSaveLoad();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -33,8 +33,8 @@
 #include "DGtal/io/readers/VolReader.h"
 #include "DGtal/io/Color.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
 
-#include <boost/pending/disjoint_sets.hpp>
 #include <boost/program_options/options_description.hpp>
 #include <boost/program_options/parsers.hpp>
 #include <boost/program_options/variables_map.hpp>
@@ -48,69 +48,6 @@ namespace po = boost::program_options;
 
 
 
-template <typename Rank, typename Parent, typename Image>
-void CCCounter(Rank& r, Parent& p, const Image& elements, const unsigned int connectivity)
-{
-  
-  boost::disjoint_sets<Rank,Parent> dsets(r, p);
-  trace.beginBlock("Initial disjoint sets construction");
-  for(typename Image::Domain::ConstIterator e = elements.domain().begin();
-      e != elements.domain().end(); ++e)
-    dsets.make_set(*e);
-  trace.endBlock();
-
-  trace.beginBlock("Merging neighboring sets");
-  typename Image::Point decx(1,0,0);
-  typename Image::Point decy(0,1,0);
-  typename Image::Point decz(0,0,1);
-  
-  //Merging process
-  for(typename Image::Domain::ConstIterator e = elements.domain().begin();
-      e !=elements.domain().end(); ++e)
-    {
-      if ( elements.domain().isInside(*e+decx) &&  
-     (elements(*e) == elements(*e+decx)))
-   dsets.union_set(*e,*e+decx);
-      
-      if ( elements.domain().isInside(*e+decy) &&  
-     (elements(*e) == elements(*e+decy)))
-  dsets.union_set(*e,*e+decy);
-      
-      if ( elements.domain().isInside(*e+decz) &&  
-     (elements(*e) == elements(*e+decz)))
-  dsets.union_set(*e,*e+decz);
-
-      if (connectivity > 6)
-  {
-    if ( elements.domain().isInside(*e+decx+decy) &&  
-         (elements(*e) == elements(*e+decx+decy)))
-      dsets.union_set(*e,*e+decx+decy);
-      
-    if ( elements.domain().isInside(*e+decx+decz) &&  
-         (elements(*e) == elements(*e+decx+decz)))
-      dsets.union_set(*e,*e+decx+decz);
-  
-    if ( elements.domain().isInside(*e+decy+decz) &&  
-         (elements(*e) == elements(*e+decy+decz)))
-      dsets.union_set(*e,*e+decy+decz);
-  
-    if (connectivity == 26)
-      if ( elements.domain().isInside(*e+decy+decz+decx) &&  
-     (elements(*e) == elements(*e+decy+decz+decx)))
-        dsets.union_set(*e,*e+decy+decz+decx);
-    
-  }
-      
-    }
-  trace.endBlock();
-  std::cout << "Number of disjoint "<<connectivity<<"-components = "
-         <<dsets.count_sets(elements.domain().begin(),
-          elements.domain().end())
-         << std::endl;
-}
-
-
-
 int main( int argc, char** argv )
 {
   // parse command line ----------------------------------------------
@@ -118,6 +55,7 @@ int main( int argc, char** argv )
   general_opt.add_options()
     ("help,h", "display this message")
     ("connectivity,c", po::value<unsigned int>()->default_value(6), "object connectivity (6,18,26)"    " (default: 6 )")
+    ("threads,t", po::value<unsigned int>()->default_value(1), "number of threads (0: all the cores, requires OpenMP)"    " (default: 1 )")
     ("input-file,i", po::value<std::string>(), "volume file (Vol)"    " (default: standard input)");
 
   po::variables_map vm;
@@ -133,11 +71,18 @@ int main( int argc, char** argv )
  string inputFilename = vm["input-file"].as<std::string>();
  unsigned int connectivity = vm["connectivity"].as<unsigned int>();
  
- if ((connectivity != 6) && (connectivity != 18) && (connectivity != 26))
+ // The connectivity gives the maximal norm-1 of the neighbors.
+ unsigned int maxNorm1 = 0;
+ switch ( connectivity )
    {
-     trace.error() << "Bard connectivity value.";
+   case 6: maxNorm1 = 1; break;
+   case 18: maxNorm1 = 2; break;
+   case 26: maxNorm1 = 3; break;
+   default:
+     trace.error() << "Bad connectivity value " << connectivity
+                   << " (6, 18 or 26 expected).";
      trace.info() << std::endl;
-     exit(1);
+     return 1;
    }
 
  typedef ImageSelector<Domain, unsigned char>::Type Image;
@@ -145,16 +90,17 @@ int main( int argc, char** argv )
 
  trace.info() << "Image loaded: "<<image<< std::endl;
 
- typedef std::map<Point,std::size_t> rank_t; // => order on Element
- typedef std::map<Point,Point> parent_t;
- rank_t rank_map;
- parent_t parent_map;
- 
- boost::associative_property_map<rank_t>   rank_pmap(rank_map);
- boost::associative_property_map<parent_t> parent_pmap(parent_map);
- 
- CCCounter(rank_pmap, parent_pmap, image, connectivity);
- 
+ typedef ConnectedComponentLabelling<Image> CCL;
+ CCL ccl( maxNorm1 );
+ ccl.setNumberOfThreads( vm["threads"].as<unsigned int>() );
+
+ trace.beginBlock("Connected component labelling");
+ CCL::LabelImage labels = ccl.compute( image );
+ trace.endBlock();
+ std::cout << "Number of disjoint "<<connectivity<<"-components = "
+           << ccl.nbComponents()
+           << std::endl;
+
 
  return 0;
 }